@@ -15,10 +15,18 @@
 #include <limits>
 
 #include "template/Client.hpp"
+#include "template/ClientPool.hpp"
 
 namespace tcp
 {
-    class TcpClient : public Client<int>
+    /**
+     * @brief Class for unencrypted TCP client
+     *
+     * @param Handler Handler policy called on incoming messages (Default: Runtime exchangeable std::function worker)
+     * @param Framing Framing policy separating messages on the stream (Default: Configured at runtime by constructor)
+     */
+    template <class Handler = ClientCallbacks, class Framing = RuntimeFraming>
+    class BasicTcpClient : public Client<int, ::std::default_delete<int>, Handler, Framing>
     {
     public:
         /**
@@ -26,7 +34,7 @@ namespace tcp
          *
          * @param os    Stream to forward incoming stream to
          */
-        TcpClient(::std::ostream &os = ::std::cout) : Client(os) {}
+        BasicTcpClient(::std::ostream &os = ::std::cout) : Client<int, ::std::default_delete<int>, Handler, Framing>(os) {}
 
         /**
          * @brief Constructor for fragmented messages
@@ -35,12 +43,12 @@ namespace tcp
          * @param messageAppend String to append to the end of each fragmented message (before the delimiter)
          * @param messageMaxLen Maximum message length (actual message + length of append string) (default is 2³² - 2 = 4294967294)
          */
-        TcpClient(char delimiter, const ::std::string &messageAppend = "", size_t messageMaxLen = ::std::numeric_limits<size_t>::max() - 1) : Client(delimiter, messageAppend, messageMaxLen) {}
+        BasicTcpClient(char delimiter, const ::std::string &messageAppend = "", size_t messageMaxLen = ::std::numeric_limits<size_t>::max() - 1) : Client<int, ::std::default_delete<int>, Handler, Framing>(delimiter, messageAppend, messageMaxLen) {}
 
         /**
          * @brief Destructor
          */
-        virtual ~TcpClient() { stop(); }
+        virtual ~BasicTcpClient() { this->stop(); }
 
     private:
         /**
@@ -57,7 +65,7 @@ namespace tcp
          *
          * @return int*
          */
-        int *connectionInit() override final { return new int{tcpSocket}; }
+        int *connectionInit() override final { return new int{this->tcpSocket}; }
 
         /**
          * @brief Deinitialize the connection (Do nothing)
@@ -67,20 +75,23 @@ namespace tcp
         /**
          * @brief Read raw data from the unencrypted TCP socket
          *
-         * @return string
+         * @param buffer
+         * @param size
+         * @return ssize_t (Number of bytes read, 0 or less if reading fails)
          */
-        ::std::string readMsg() override final
+        ssize_t readMsg(char *buffer, size_t size) override final
         {
-            // Buffer to store the data received from the server
-            char buffer[MAXIMUM_RECEIVE_PACKAGE_SIZE]{0};
-
-            // Wait for the server to send data
-            ssize_t lenMsg{recv(tcpSocket, buffer, MAXIMUM_RECEIVE_PACKAGE_SIZE, 0)};
-
-            // Return the received message as a string (Empty string if receive failed)
-            return ::std::string{buffer, 0 < lenMsg ? static_cast<size_t>(lenMsg) : 0UL};
+            // Wait for the server to send data and read it directly into the given buffer
+            return recv(this->tcpSocket, buffer, size, 0);
         }
 
+        /**
+         * @brief Unencrypted data can be spliced from the socket directly (Return true).
+         *
+         * @return bool
+         */
+        bool spliceSupported() const override final { return true; }
+
         /**
          * @brief Send raw data to the unencrypted TCP socket
          *
@@ -94,14 +105,58 @@ namespace tcp
             ::std::cout << DEBUGINFO << ": Send to server: " << msg << ::std::endl;
 #endif // DEVELOP
 
-            const size_t lenMsg{msg.size()};
-            return send(tcpSocket, msg.c_str(), lenMsg, 0) == (ssize_t)lenMsg;
+            return sendAll(msg.c_str(), msg.size(), 0);
+        }
+
+        /**
+         * @brief Send collected messages of a batch to the unencrypted TCP socket.
+         * If more data follows, the last partly filled segment is held back until it is sent (MSG_MORE).
+         *
+         * @param data
+         * @param more
+         * @return bool
+         */
+        bool writeBatch(const ::std::string &data, const bool more) override final
+        {
+#ifdef DEVELOP
+            ::std::cout << DEBUGINFO << ": Send batch to server: " << data << ::std::endl;
+#endif // DEVELOP
+
+            return sendAll(data.c_str(), data.size(), more ? MSG_MORE : 0);
+        }
+
+        /**
+         * @brief Send all data to the unencrypted TCP socket.
+         * If the non-blocking socket of a shared I/O context can't take all data at once, wait until it can take more.
+         *
+         * @param data
+         * @param len
+         * @param flags     Flags for send(2)
+         * @return bool
+         */
+        bool sendAll(const char *data, size_t len, const int flags)
+        {
+            while (0 < len)
+            {
+                const ssize_t lenSent{send(this->tcpSocket, data, len, flags)};
+                if (0 < lenSent)
+                {
+                    data += lenSent;
+                    len -= lenSent;
+                }
+                else if (0 == lenSent || (EAGAIN != errno && EWOULDBLOCK != errno) || !this->waitForSocket(POLLOUT))
+                    return false;
+            }
+            return true;
         }
 
         // Disallow copy
-        TcpClient(const TcpClient &) = delete;
-        TcpClient &operator=(const TcpClient &) = delete;
+        BasicTcpClient(const BasicTcpClient &) = delete;
+        BasicTcpClient &operator=(const BasicTcpClient &) = delete;
     };
+
+    // TCP client with runtime exchangeable std::function worker
+    using TcpClient = BasicTcpClient<>;
 }
 
 #endif // TCPCLIENT_HPP_
@@ -18,13 +18,20 @@
 
 namespace tcp
 {
-   class TcpServer : public Server<int>
+   /**
+    * @brief Class for unencrypted TCP server
+    *
+    * @param Handler Handler policy called on server events (Default: Runtime exchangeable std::function workers)
+    * @param Framing Framing policy separating messages on the stream (Default: Configured at runtime by constructor)
+    */
+   template <class Handler = ServerCallbacks, class Framing = RuntimeFraming>
+   class BasicTcpServer : public Server<int, ::std::default_delete<int>, Handler, Framing>
    {
    public:
       /**
        * @brief Constructor for continuous stream forwarding
        */
-      TcpServer() : Server{} {}
+      BasicTcpServer() : Server<int, ::std::default_delete<int>, Handler, Framing>{} {}
 
       /**
        * @brief Constructor for fragmented messages
@@ -33,12 +40,12 @@ namespace tcp
        * @param messageAppend String to append to the end of each fragmented message (before the delimiter)
        * @param messageMaxLen Maximum message length (actual message + length of append string) (default is 2³² - 2 = 4294967294)
        */
-      TcpServer(char delimiter, const ::std::string &messageAppend = "", size_t messageMaxLen = ::std::numeric_limits<size_t>::max() - 1) : Server{delimiter, messageAppend, messageMaxLen} {}
+      BasicTcpServer(char delimiter, const ::std::string &messageAppend = "", size_t messageMaxLen = ::std::numeric_limits<size_t>::max() - 1) : Server<int, ::std::default_delete<int>, Handler, Framing>{delimiter, messageAppend, messageMaxLen} {}
 
       /**
        * @brief Destructor
        */
-      virtual ~TcpServer() { stop(); }
+      virtual ~BasicTcpServer() { this->stop(); }
 
    private:
       /**
@@ -66,23 +73,26 @@ namespace tcp
       /**
        * @brief Read data from a specific client (Identified by its TCP ID).
        * This method blocks until data is available.
-       * If no data is available, it returns an empty string.
+       * If reading fails, it returns 0 or less.
        *
        * @param socket
-       * @return string
+       * @param buffer
+       * @param size
+       * @return ssize_t (Number of bytes read)
        */
-      ::std::string readMsg(int *socket) override final
+      ssize_t readMsg(int *socket, char *buffer, size_t size) override final
       {
-         // Buffer for received data.
-         char buffer[MAXIMUM_RECEIVE_PACKAGE_SIZE]{0};
-
-         // Wait for data to be available.
-         ssize_t lenMsg{recv(*socket, buffer, MAXIMUM_RECEIVE_PACKAGE_SIZE, 0)};
-
-         // Return received data as string (or empty string if no data is available).
-         return ::std::string{buffer, 0 < lenMsg ? static_cast<size_t>(lenMsg) : 0UL};
+         // Wait for data to be available and read it directly into the given buffer.
+         return recv(*socket, buffer, size, 0);
       }
 
+      /**
+       * @brief Unencrypted data can be spliced from the socket directly (Return true).
+       *
+       * @return bool
+       */
+      bool spliceSupported() const override final { return true; }
+
       /**
        * @brief Send raw data to a specific client (Identified by its TCP ID).
        * Send message over unencrypted TCP connection.
@@ -101,10 +111,32 @@ namespace tcp
          return send(clientId, msg.c_str(), lenMsg, 0) == (ssize_t)lenMsg;
       }
 
+      /**
+       * @brief Send collected messages of a batch to a specific client.
+       * If more data follows, the last partly filled segment is held back until it is sent (MSG_MORE).
+       *
+       * @param clientId
+       * @param data
+       * @param more
+       * @return bool (true on success, false on failure)
+       */
+      bool writeBatch(const int clientId, const ::std::string &data, const bool more) override final
+      {
+#ifdef DEVELOP
+         ::std::cout << DEBUGINFO << ": Send batch to client " << clientId << ": " << data << ::std::endl;
+#endif // DEVELOP
+
+         const size_t lenData{data.size()};
+         return send(clientId, data.c_str(), lenData, more ? MSG_MORE : 0) == (ssize_t)lenData;
+      }
+
       // Disallow copy
-      TcpServer(const TcpServer &) = delete;
-      TcpServer &operator=(const TcpServer &) = delete;
+      BasicTcpServer(const BasicTcpServer &) = delete;
+      BasicTcpServer &operator=(const BasicTcpServer &) = delete;
    };
+
+   // TCP server with runtime exchangeable std::function workers
+   using TcpServer = BasicTcpServer<>;
 }
 
 #endif // TCPSERVER_HPP_
@@ -20,6 +20,7 @@
 #endif // DEVELOP
 
 #include "template/Client.hpp"
+#include "template/ClientPool.hpp"
 
 namespace tcp
 {
@@ -37,8 +38,12 @@ namespace tcp
 
     /**
      * @brief Class for encrypted TLS client
+     *
+     * @param Handler Handler policy called on incoming messages (Default: Runtime exchangeable std::function worker)
+     * @param Framing Framing policy separating messages on the stream (Default: Configured at runtime by constructor)
      */
-    class TlsClient : public Client<SSL, Client_SSL_Deleter>
+    template <class Handler = ClientCallbacks, class Framing = RuntimeFraming>
+    class BasicTlsClient : public Client<SSL, Client_SSL_Deleter, Handler, Framing>
     {
     public:
         /**
@@ -46,7 +51,7 @@ namespace tcp
          *
          * @param os    Stream to forward incoming stream to
          */
-        TlsClient(::std::ostream &os = ::std::cout) : Client(os) {}
+        BasicTlsClient(::std::ostream &os = ::std::cout) : Client<SSL, Client_SSL_Deleter, Handler, Framing>(os) {}
 
         /**
          * @brief Constructor for fragmented messages
@@ -56,7 +61,7 @@ namespace tcp
          * @param messageAppend String to append to the end of each fragmented message (before the delimiter)
          * @param messageMaxLen Maximum message length (actual message + length of append string) (default is 2³² - 2 = 4294967294)
          */
-        TlsClient(char delimiter, const ::std::string &messageAppend = "", size_t messageMaxLen = ::std::numeric_limits<size_t>::max() - 1) : Client(delimiter, messageAppend, messageMaxLen),
+        BasicTlsClient(char delimiter, const ::std::string &messageAppend = "", size_t messageMaxLen = ::std::numeric_limits<size_t>::max() - 1) : Client<SSL, Client_SSL_Deleter, Handler, Framing>(delimiter, messageAppend, messageMaxLen),
                                                                                                                                               CERTIFICATEPATH_CA{},
                                                                                                                                               CERTIFICATEPATH_CERT{},
                                                                                                                                               CERTIFICATEPATH_KEY{},
@@ -65,7 +70,7 @@ namespace tcp
         /**
          * @brief Destructor
          */
-        virtual ~TlsClient() { stop(); }
+        virtual ~BasicTlsClient() { this->stop(); }
 
         /**
          * @brief Get specific subject part as string of the certificate of the server.
@@ -79,7 +84,7 @@ namespace tcp
             char buf[256]{0};
 
             // Check if server is connected
-            if (!isRunning())
+            if (!this->isRunning())
             {
 #ifdef DEVELOP
                 ::std::cerr << DEBUGINFO << ": Client is not running, means not connected to any server" << ::std::endl;
@@ -89,7 +94,7 @@ namespace tcp
             }
 
             // Read server certificate from TLS channel
-            ::std::unique_ptr<X509, void (*)(X509 *)> remoteCert{SSL_get_peer_certificate(clientSocket.get()), X509_free};
+            ::std::unique_ptr<X509, void (*)(X509 *)> remoteCert{SSL_get_peer_certificate(this->clientSocket.get()), X509_free};
 
             // Get whole subject part from server certificate
             X509_NAME *remoteCertSubject{X509_get_subject_name(remoteCert.get())};
@@ -179,10 +184,16 @@ namespace tcp
                 ::std::cerr << DEBUGINFO << ": Error when setting encryption method to latest client side TLS version" << ::std::endl;
 #endif // DEVELOP
 
-                stop();
+                this->stop();
                 return CLIENT_ERROR_START_SET_CONTEXT;
             }
 
+            // Keep the last session of this client to resume it on reconnect (A session of the last start is not used)
+            lastSession.reset();
+            SSL_CTX_set_app_data(clientContext.get(), this);
+            SSL_CTX_set_session_cache_mode(clientContext.get(), SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+            SSL_CTX_sess_set_new_cb(clientContext.get(), storeSession);
+
             // Get pointer to certificate paths for C-style usage
             const char *const pathToCaCert_p{CERTIFICATEPATH_CA.c_str()};
             const char *const pathToCert_p{CERTIFICATEPATH_CERT.c_str()};
@@ -200,7 +211,7 @@ namespace tcp
                     ::std::cerr << DEBUGINFO << ": CA certificate file does not exist" << ::std::endl;
 #endif // DEVELOP
 
-                    stop();
+                    this->stop();
                     return CLIENT_ERROR_START_WRONG_CA_PATH;
                 }
 
@@ -211,7 +222,7 @@ namespace tcp
                     ::std::cerr << DEBUGINFO << ": Error when loading the CA certificate the client should trust: " << pathToCaCert_p << ::std::endl;
 #endif // DEVELOP
 
-                    stop();
+                    this->stop();
                     return CLIENT_ERROR_START_WRONG_CA;
                 }
             }
@@ -226,7 +237,7 @@ namespace tcp
                     ::std::cerr << DEBUGINFO << ": Client certificate file does not exist" << ::std::endl;
 #endif // DEVELOP
 
-                    stop();
+                    this->stop();
                     return CLIENT_ERROR_START_WRONG_CERT_PATH;
                 }
 
@@ -237,7 +248,7 @@ namespace tcp
                     ::std::cerr << DEBUGINFO << ": Client private key file does not exist" << ::std::endl;
 #endif // DEVELOP
 
-                    stop();
+                    this->stop();
                     return CLIENT_ERROR_START_WRONG_KEY_PATH;
                 }
 
@@ -248,7 +259,7 @@ namespace tcp
                     ::std::cerr << DEBUGINFO << ": Error when loading the client certificate: " << pathToCert_p << ::std::endl;
 #endif // DEVELOP
 
-                    stop();
+                    this->stop();
                     return CLIENT_ERROR_START_WRONG_CERT;
                 }
 
@@ -259,7 +270,7 @@ namespace tcp
                     ::std::cerr << DEBUGINFO << ": Error when loading the client private key: " << pathToPrivKey_p << ::std::endl;
 #endif // DEVELOP
 
-                    stop();
+                    this->stop();
                     return CLIENT_ERROR_START_WRONG_KEY;
                 }
             }
@@ -312,7 +323,7 @@ namespace tcp
             }
 
             // Bind the TLS channel to the TCP socket (Return nullptr if failed)
-            if (!SSL_set_fd(tlsSocket, tcpSocket))
+            if (!SSL_set_fd(tlsSocket, this->tcpSocket))
             {
 #ifdef DEVELOP
                 ::std::cerr << DEBUGINFO << ": Error when binding the TLS channel to the TCP socket" << ::std::endl;
@@ -323,6 +334,14 @@ namespace tcp
                 return nullptr;
             }
 
+            // Return from reading after protocol data without application data (e.g. session tickets),
+            // so reading never blocks longer than the data signaled on the socket (See readWouldBlock)
+            SSL_clear_mode(tlsSocket, SSL_MODE_AUTO_RETRY);
+
+            // Resume the last session if there is one (Full handshake if the server doesn't know it anymore)
+            if (lastSession.get())
+                SSL_set_session(tlsSocket, lastSession.get());
+
             // Do TLS handshake (Return nullptr if failed)
             if (1 != SSL_connect(tlsSocket))
             {
@@ -355,8 +374,8 @@ namespace tcp
         void connectionDeinit() override final
         {
             // Shutdown the TLS channel. Memory will be freed automatically on deletion
-            if (clientSocket.get())
-                SSL_shutdown(clientSocket.get());
+            if (this->clientSocket.get())
+                SSL_shutdown(this->clientSocket.get());
 
             return;
         }
@@ -364,18 +383,36 @@ namespace tcp
         /**
          * @brief Read raw data from the encrypted TLS socket
          *
-         * @return string
+         * @param buffer
+         * @param size
+         * @return ssize_t (Number of bytes read, 0 or less if reading fails)
          */
-        ::std::string readMsg() override final
+        ssize_t readMsg(char *buffer, size_t size) override final
         {
-            // Buffer for incoming message
-            char buffer[MAXIMUM_RECEIVE_PACKAGE_SIZE]{0};
+            // Wait for server to send message and decrypt it directly into the given buffer
+            return SSL_read(this->clientSocket.get(), buffer, static_cast<int>(size));
+        }
 
-            // Wait for server to send message
-            const int lenMsg{SSL_read(clientSocket.get(), buffer, MAXIMUM_RECEIVE_PACKAGE_SIZE)};
+        /**
+         * @brief Check if the last read only processed protocol data or an incomplete record and the TLS connection is still open
+         *
+         * @param result
+         * @return bool
+         */
+        bool readWouldBlock(const ssize_t result) override final
+        {
+            const int error{SSL_get_error(this->clientSocket.get(), static_cast<int>(result))};
+            return SSL_ERROR_WANT_READ == error || SSL_ERROR_WANT_WRITE == error;
+        }
 
-            // Return received message as string (Return empty string if receive failed)
-            return ::std::string{buffer, 0 < lenMsg ? static_cast<size_t>(lenMsg) : 0UL};
+        /**
+         * @brief Check if decrypted data is buffered in the TLS channel
+         *
+         * @return bool
+         */
+        bool pendingData() const override final
+        {
+            return 0 < SSL_pending(this->clientSocket.get());
         }
 
         /**
@@ -395,12 +432,42 @@ namespace tcp
             const int lenMsg{(int)msg.size()};
 
             // Send message to server (Return false if send failed)
-            return SSL_write(clientSocket.get(), msg.c_str(), lenMsg) == lenMsg;
+            // If the non-blocking socket of a shared I/O context isn't ready, wait for it and repeat the same write
+            while (1)
+            {
+                const int lenSent{SSL_write(this->clientSocket.get(), msg.c_str(), lenMsg)};
+                if (lenSent == lenMsg)
+                    return true;
+                const int error{SSL_get_error(this->clientSocket.get(), lenSent)};
+                if (SSL_ERROR_WANT_WRITE == error && this->waitForSocket(POLLOUT))
+                    continue;
+                if (SSL_ERROR_WANT_READ == error && this->waitForSocket(POLLIN))
+                    continue;
+                return false;
+            }
+        }
+
+        /**
+         * @brief Keep a copy of a new session received from the server (Called by OpenSSL).
+         * The session of the connection itself is marked not resumable if the connection is lost unexpectedly, the copy is not.
+         *
+         * @param ssl
+         * @param session
+         * @return int (0 = Session is not taken over)
+         */
+        static int storeSession(SSL *ssl, SSL_SESSION *session)
+        {
+            BasicTlsClient *client{static_cast<BasicTlsClient *>(SSL_CTX_get_app_data(SSL_get_SSL_CTX(ssl)))};
+            client->lastSession.reset(SSL_SESSION_dup(session));
+            return 0;
         }
 
         // TLS context
         ::std::unique_ptr<SSL_CTX, void (*)(SSL_CTX *)> clientContext{nullptr, SSL_CTX_free};
 
+        // Last session received from the server
+        ::std::unique_ptr<SSL_SESSION, void (*)(SSL_SESSION *)> lastSession{nullptr, SSL_SESSION_free};
+
         // Certificate paths
         ::std::string CERTIFICATEPATH_CA;
         ::std::string CERTIFICATEPATH_CERT;
@@ -410,9 +477,12 @@ namespace tcp
         bool SERVER_AUTHENTICATION;
 
         // Disallow copy
-        TlsClient(const TlsClient &) = delete;
-        TlsClient &operator=(const TlsClient &) = delete;
+        BasicTlsClient(const BasicTlsClient &) = delete;
+        BasicTlsClient &operator=(const BasicTlsClient &) = delete;
     };
+
+    // TLS client with runtime exchangeable std::function worker
+    using TlsClient = BasicTlsClient<>;
 }
 
 #endif // TLSCLIENT_HPP_
@@ -33,13 +33,20 @@ namespace tcp
       }
    };
 
-   class TlsServer : public Server<SSL, Server_SSL_Deleter>
+   /**
+    * @brief Class for encrypted TLS server
+    *
+    * @param Handler Handler policy called on server events (Default: Runtime exchangeable std::function workers)
+    * @param Framing Framing policy separating messages on the stream (Default: Configured at runtime by constructor)
+    */
+   template <class Handler = ServerCallbacks, class Framing = RuntimeFraming>
+   class BasicTlsServer : public Server<SSL, Server_SSL_Deleter, Handler, Framing>
    {
    public:
       /**
        * @brief Constructor for continuous stream forwarding
        */
-      TlsServer() : Server{} {}
+      BasicTlsServer() : Server<SSL, Server_SSL_Deleter, Handler, Framing>{} {}
 
       /**
        * @brief Constructor for fragmented messages
@@ -49,7 +56,7 @@ namespace tcp
        * @param messageAppend String to append to the end of each fragmented message (before the delimiter)
        * @param messageMaxLen Maximum message length (actual message + length of append string) (default is 2³² - 2 = 4294967294)
        */
-      TlsServer(char delimiter, const ::std::string &messageAppend = "", size_t messageMaxLen = ::std::numeric_limits<size_t>::max() - 1) : Server{delimiter, messageAppend, messageMaxLen},
+      BasicTlsServer(char delimiter, const ::std::string &messageAppend = "", size_t messageMaxLen = ::std::numeric_limits<size_t>::max() - 1) : Server<SSL, Server_SSL_Deleter, Handler, Framing>{delimiter, messageAppend, messageMaxLen},
                                                                                                                                             CERTIFICATEPATH_CA{},
                                                                                                                                             CERTIFICATEPATH_CERT{},
                                                                                                                                             CERTIFICATEPATH_KEY{},
@@ -58,39 +65,25 @@ namespace tcp
       /**
        * @brief Destructor
        */
-      virtual ~TlsServer() { stop(); }
+      virtual ~BasicTlsServer() { this->stop(); }
 
       /**
        * @brief Get specific subject part as string of the certificate of a specific connected client (Identified by its TCP ID).
+       *        The subject is read once during the TLS handshake, so this call needs no lock and no certificate parsing.
        *        Throw Server_error if client ID is not found or NID is invalid.
        *
        * @param clientId
        * @param subjPart
        * @return string
        */
-      ::std::string getSubjPartFromClientCert(const int clientId, const int subjPart)
+      ::std::string getSubjPartFromClientCert(const int clientId, const int subjPart) const
       {
-         char buf[256]{0};
-         ::std::lock_guard<::std::mutex> lck{activeConnections_m};
-
-         // Check if client is connected
-         if (activeConnections.find(clientId) == activeConnections.end())
-         {
-#ifdef DEVELOP
-            ::std::cerr << DEBUGINFO << ": No connected client " << clientId << ::std::endl;
-#endif // DEVELOP
-
-            throw Server_error("No connected client " + ::std::to_string(clientId) + " to read certificate subject part from");
-         }
-
-         // Read client certificate from TLS channel
-         ::std::unique_ptr<X509, void (*)(X509 *)> remoteCert{SSL_get_peer_certificate(activeConnections[clientId].get()), X509_free};
-
-         // Get whole subject part from client certificate
-         X509_NAME *remoteCertSubject{X509_get_subject_name(remoteCert.get())};
+         // Get cached connection metadata (Throws if client is not connected)
+         const ::std::shared_ptr<const ConnectionInfo> info{this->getClientInfo(clientId)};
 
          // Get specific part from subject
-         if (-1 == X509_NAME_get_text_by_NID(remoteCertSubject, subjPart, buf, 256))
+         const auto it{info->certSubject.find(subjPart)};
+         if (it == info->certSubject.end())
          {
 #ifdef DEVELOP
             ::std::cerr << DEBUGINFO << ": Invalid NID " << subjPart << " for certificate subject" << ::std::endl;
@@ -100,7 +93,7 @@ namespace tcp
          }
 
          // Return subject part as string
-         return ::std::string(buf);
+         return it->second;
       }
 
       /**
@@ -177,7 +170,7 @@ namespace tcp
             ::std::cerr << DEBUGINFO << ": Error when setting encryption method" << ::std::endl;
 #endif // DEVELOP
 
-            stop();
+            this->stop();
             return SERVER_ERROR_START_SET_CONTEXT;
          }
 
@@ -197,7 +190,7 @@ namespace tcp
                ::std::cerr << DEBUGINFO << ": CA certificate file does not exist" << ::std::endl;
 #endif // DEVELOP
 
-               stop();
+               this->stop();
                return SERVER_ERROR_START_WRONG_CA_PATH;
             }
 
@@ -209,7 +202,7 @@ namespace tcp
                ::std::cerr << DEBUGINFO << ": Error when reading CA certificate \"" << pathToCaCert_p << "\"" << ::std::endl;
 #endif // DEVELOP
 
-               stop();
+               this->stop();
                return SERVER_ERROR_START_WRONG_CA;
             }
 
@@ -225,7 +218,7 @@ namespace tcp
             ::std::cerr << DEBUGINFO << ": Server certificate file does not exist" << ::std::endl;
 #endif // DEVELOP
 
-            stop();
+            this->stop();
             return SERVER_ERROR_START_WRONG_CERT_PATH;
          }
 
@@ -236,7 +229,7 @@ namespace tcp
             ::std::cerr << DEBUGINFO << ": Server private key file does not exist" << ::std::endl;
 #endif // DEVELOP
 
-            stop();
+            this->stop();
             return SERVER_ERROR_START_WRONG_KEY_PATH;
          }
 
@@ -248,7 +241,7 @@ namespace tcp
             ::std::cerr << DEBUGINFO << ": Error when loading server certificate \"" << pathToCert_p << "\"" << ::std::endl;
 #endif // DEVELOP
 
-            stop();
+            this->stop();
             return SERVER_ERROR_START_WRONG_CERT;
          }
 
@@ -260,13 +253,16 @@ namespace tcp
             ::std::cerr << DEBUGINFO << ": Error when loading server private key \"" << pathToPrivKey_p << "\"" << ::std::endl;
 #endif // DEVELOP
 
-            stop();
+            this->stop();
             return SERVER_ERROR_START_WRONG_KEY;
          }
 
          // Set TLS mode (Auto retry)
          SSL_CTX_set_mode(serverContext.get(), SSL_MODE_AUTO_RETRY);
 
+         // Set session ID context, so reconnecting clients can resume their session (Also with client authentication)
+         SSL_CTX_set_session_id_context(serverContext.get(), SESSION_ID_CONTEXT, sizeof(SESSION_ID_CONTEXT) - 1);
+
          // Force client authentication if defined
          // SSL_VERIFY_NONE set automatically otherwise
          if (CLIENT_AUTHENTICATION && validCa)
@@ -373,24 +369,63 @@ namespace tcp
          return;
       }
 
+      /**
+       * @brief Read all subject parts of the client certificate once after the TLS handshake.
+       *
+       * @param socket
+       * @param info
+       */
+      void readConnectionInfo(SSL *socket, ConnectionInfo &info) override final
+      {
+         // Read client certificate from TLS channel (Client may not have sent any)
+         ::std::unique_ptr<X509, void (*)(X509 *)> remoteCert{SSL_get_peer_certificate(socket), X509_free};
+         if (!remoteCert.get())
+            return;
+
+         // Get whole subject part from client certificate
+         X509_NAME *remoteCertSubject{X509_get_subject_name(remoteCert.get())};
+
+         // Store each subject part by its NID (First entry wins if a NID occurs multiple times)
+         const int numEntries{X509_NAME_entry_count(remoteCertSubject)};
+         for (int i{0}; i < numEntries; i += 1)
+         {
+            const int nid{OBJ_obj2nid(X509_NAME_ENTRY_get_object(X509_NAME_get_entry(remoteCertSubject, i)))};
+            if (info.certSubject.find(nid) != info.certSubject.end())
+               continue;
+
+            char buf[256]{0};
+            if (-1 != X509_NAME_get_text_by_NID(remoteCertSubject, nid, buf, 256))
+               info.certSubject[nid] = buf;
+         }
+
+         return;
+      }
+
       /**
        * @brief Read data from a specific client (Identified by its TCP ID).
        * This method blocks until data is available.
-       * If no data is available, it returns an empty string.
+       * If reading fails, it returns 0 or less.
        *
        * @param socket
-       * @return string
+       * @param buffer
+       * @param size
+       * @return ssize_t (Number of bytes read)
        */
-      ::std::string readMsg(SSL *socket) override final
+      ssize_t readMsg(SSL *socket, char *buffer, size_t size) override final
       {
-         // Buffer for incoming message
-         char buffer[MAXIMUM_RECEIVE_PACKAGE_SIZE]{0};
-
-         // Wait for message from client
-         const int lenMsg{SSL_read(socket, buffer, MAXIMUM_RECEIVE_PACKAGE_SIZE)};
+         // Wait for message from client and decrypt it directly into the given buffer
+         return SSL_read(socket, buffer, static_cast<int>(size));
+      }
 
-         // Return message as string if it was received successfully (Return empty string if it fails)
-         return ::std::string{buffer, 0 < lenMsg ? static_cast<size_t>(lenMsg) : 0UL};
+      /**
+       * @brief Check if decrypted data is buffered in the TLS channel of a client
+       *
+       * @param socket
+       * @return bool
+       */
+      bool pendingData(SSL *socket) const override final
+      {
+         return 0 < SSL_pending(socket);
       }
 
       /**
@@ -413,7 +448,7 @@ namespace tcp
 #endif // DEVELOP
 
          // Get TLS channel for client to send message to
-         SSL *socket{activeConnections[clientId].get()};
+         SSL *socket{this->activeConnections[clientId].get()};
 
          // Send message to client
          // Return false if it fails
@@ -423,6 +458,9 @@ namespace tcp
       // TLS context of the server
       ::std::unique_ptr<SSL_CTX, void (*)(SSL_CTX *)> serverContext{nullptr, SSL_CTX_free};
 
+      // Session ID context sessions of this server are bound to
+      static constexpr unsigned char SESSION_ID_CONTEXT[]{"TCP_ServerClient"};
+
       // Certificate paths
       ::std::string CERTIFICATEPATH_CA;
       ::std::string CERTIFICATEPATH_CERT;
@@ -432,9 +470,12 @@ namespace tcp
       bool CLIENT_AUTHENTICATION;
 
       // Disallow copy
-      TlsServer(const TlsServer &) = delete;
-      TlsServer &operator=(const TlsServer &) = delete;
+      BasicTlsServer(const BasicTlsServer &) = delete;
+      BasicTlsServer &operator=(const BasicTlsServer &) = delete;
    };
+
+   // TLS server with runtime exchangeable std::function workers
+   using TlsServer = BasicTlsServer<>;
 }
 
 #endif // TLSSERVER_HPP_
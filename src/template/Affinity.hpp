@@ -0,0 +1,152 @@
+/**
+ * @file Affinity.hpp
+ * @author Nils Henrich
+ * @brief Pinning of threads to CPUs and NUMA topology lookup.
+ * NUMA nodes are read from sysfs, so no NUMA library is needed. Memory is placed on a node by the Linux first-touch policy:
+ * Pages are taken from the node of the CPU that touches them first.
+ * @version 3.2.1
+ * @date 2025-02-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef AFFINITY_HPP_
+#define AFFINITY_HPP_
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <pthread.h>
+#include <sched.h>
+#include <dirent.h>
+#include <sys/socket.h>
+
+namespace tcp
+{
+    /**
+     * @brief CPUs the threads of a server or client run on (Empty = Not pinned)
+     */
+    struct ThreadAffinity
+    {
+        ::std::vector<int> acceptor{}; // Thread accepting new connections (Server only)
+        ::std::vector<int> io{};       // Receive threads (Workers of a client I/O context are pinned with its constructor)
+        ::std::vector<int> workers{};  // Threads running the message and request workers
+
+        // Pin the receive thread of a connection to the CPU its data is processed on by the kernel (SO_INCOMING_CPU)
+        // and its workers to the NUMA node of this CPU (Used instead of io and workers if the CPU is known)
+        bool followIncomingCpu{false};
+
+        // Take the receive buffers of a connection from a pool of the NUMA node its receive thread runs on (Server only)
+        bool numaLocalBuffers{false};
+    };
+
+    /**
+     * @brief Pin the calling thread to a set of CPUs
+     *
+     * @param cpus  CPU numbers (Empty = Don't pin)
+     * @return bool (false if the thread could not be pinned, e.g. a CPU doesn't exist)
+     */
+    inline bool pinCurrentThread(const ::std::vector<int> &cpus)
+    {
+        if (cpus.empty())
+            return true;
+
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        for (const int cpu : cpus)
+        {
+            if (0 > cpu || CPU_SETSIZE <= cpu)
+                return false;
+            CPU_SET(cpu, &cpuSet);
+        }
+        return 0 == pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+    }
+
+    /**
+     * @brief Get the CPU the kernel processed the last incoming data of a socket on
+     *
+     * @param fd
+     * @return int (-1 if unknown or not supported)
+     */
+    inline int incomingCpu(const int fd)
+    {
+#ifdef SO_INCOMING_CPU
+        int cpu{-1};
+        socklen_t cpu_len{sizeof(cpu)};
+        if (0 == getsockopt(fd, SOL_SOCKET, SO_INCOMING_CPU, &cpu, &cpu_len))
+            return cpu;
+#endif // SO_INCOMING_CPU
+        (void)fd;
+        return -1;
+    }
+
+    /**
+     * @brief Get the NUMA node of a CPU
+     *
+     * @param cpu
+     * @return int (0 if the system has no NUMA information)
+     */
+    inline int nodeOfCpu(const int cpu)
+    {
+        // The CPU directory contains a link "node<N>" to its node
+        DIR *cpuDir{opendir(("/sys/devices/system/cpu/cpu" + ::std::to_string(cpu)).c_str())};
+        if (!cpuDir)
+            return 0;
+        int node{0};
+        while (struct dirent *entry = readdir(cpuDir))
+        {
+            const ::std::string name{entry->d_name};
+            if (4 < name.size() && 0 == name.compare(0, 4, "node") && ::std::string::npos == name.find_first_not_of("0123456789", 4))
+            {
+                node = ::std::stoi(name.substr(4));
+                break;
+            }
+        }
+        closedir(cpuDir);
+        return node;
+    }
+
+    /**
+     * @brief Get the NUMA node of the CPU the calling thread runs on
+     *
+     * @return int (0 if unknown)
+     */
+    inline int currentNode()
+    {
+        const int cpu{sched_getcpu()};
+        return 0 <= cpu ? nodeOfCpu(cpu) : 0;
+    }
+
+    /**
+     * @brief Get all CPUs of a NUMA node
+     *
+     * @param node
+     * @return vector<int> (Empty if the system has no NUMA information)
+     */
+    inline ::std::vector<int> cpusOfNode(const int node)
+    {
+        // The CPU list has the format "0-3,8,10-11"
+        ::std::ifstream cpuList{"/sys/devices/system/node/node" + ::std::to_string(node) + "/cpulist"};
+        ::std::vector<int> cpus;
+        ::std::string range;
+        while (::std::getline(cpuList, range, ','))
+        {
+            const size_t dash{range.find('-')};
+            try
+            {
+                const int first{::std::stoi(range.substr(0, dash))};
+                const int last{::std::string::npos == dash ? first : ::std::stoi(range.substr(dash + 1))};
+                for (int cpu{first}; cpu <= last; cpu += 1)
+                    cpus.push_back(cpu);
+            }
+            catch (const ::std::exception &)
+            {
+                return {};
+            }
+        }
+        return cpus;
+    }
+}
+
+#endif // AFFINITY_HPP_
@@ -0,0 +1,233 @@
+/**
+ * @file BufferPool.hpp
+ * @author Nils Henrich
+ * @brief Size-classed pool for receive buffers implemented as std::pmr::memory_resource.
+ * Released blocks are kept per size class and handed out again, so connections coming and going
+ * and adaptive buffers growing and shrinking don't hit malloc every time.
+ * @version 3.2.1
+ * @date 2025-02-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef BUFFERPOOL_HPP_
+#define BUFFERPOOL_HPP_
+
+#include <memory_resource>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "exception.hpp"
+
+namespace tcp
+{
+    /**
+     * @brief Counters of a buffer pool
+     */
+    struct BufferPoolStats
+    {
+        uint64_t hits{0};      // Allocations served from a released block
+        uint64_t misses{0};    // Allocations forwarded to the upstream resource
+        size_t bytesInUse{0};  // Bytes currently handed out (Rounded up to the size class)
+        size_t bytesCached{0}; // Bytes of released blocks kept for reuse
+    };
+
+    /**
+     * @brief Memory resource keeping released blocks in power-of-two size classes (64 bytes to 1 MiB) for reuse.
+     * Larger or over-aligned requests are forwarded to the upstream resource directly.
+     * Each size class has its own lock, so threads allocating different sizes don't block each other.
+     */
+    class BufferPool : public ::std::pmr::memory_resource
+    {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * @param upstream  Resource to get new blocks from (Default: new/delete)
+         */
+        explicit BufferPool(::std::pmr::memory_resource *upstream = ::std::pmr::new_delete_resource()) : upstream{upstream} {}
+
+        /**
+         * @brief Destructor (Return all cached blocks to the upstream resource)
+         */
+        virtual ~BufferPool()
+        {
+            release();
+        }
+
+        /**
+         * @brief Replace the upstream resource.
+         * All cached blocks are returned to the old upstream resource first.
+         * Throw Error if blocks are still in use, because they would be returned to the wrong resource.
+         *
+         * @param newUpstream
+         */
+        void setUpstream(::std::pmr::memory_resource *newUpstream)
+        {
+            if (0 != bytesInUse.load(::std::memory_order_relaxed))
+                throw Error("Unable to change upstream resource of buffer pool: " + ::std::to_string(bytesInUse.load()) + " bytes still in use");
+
+            release();
+            upstream = newUpstream ? newUpstream : ::std::pmr::new_delete_resource();
+            return;
+        }
+
+        /**
+         * @brief Return all cached blocks to the upstream resource
+         */
+        void release()
+        {
+            for (size_t i{0}; i < NUMBER_OF_SIZE_CLASSES; i += 1)
+            {
+                ::std::lock_guard<::std::mutex> lck{sizeClasses[i].freeBlocks_m};
+                for (void *block : sizeClasses[i].freeBlocks)
+                    upstream->deallocate(block, classSize(i), BLOCK_ALIGNMENT);
+                bytesCached.fetch_sub(sizeClasses[i].freeBlocks.size() * classSize(i), ::std::memory_order_relaxed);
+                sizeClasses[i].freeBlocks.clear();
+            }
+            return;
+        }
+
+        /**
+         * @brief Get the counters of this pool
+         *
+         * @return BufferPoolStats
+         */
+        BufferPoolStats getStats() const
+        {
+            BufferPoolStats stats;
+            stats.hits = hits.load(::std::memory_order_relaxed);
+            stats.misses = misses.load(::std::memory_order_relaxed);
+            stats.bytesInUse = bytesInUse.load(::std::memory_order_relaxed);
+            stats.bytesCached = bytesCached.load(::std::memory_order_relaxed);
+            return stats;
+        }
+
+    protected:
+        void *do_allocate(size_t bytes, size_t alignment) override
+        {
+            // Requests not fitting into a size class are forwarded directly
+            const size_t index{classIndex(bytes)};
+            if (NUMBER_OF_SIZE_CLASSES <= index || BLOCK_ALIGNMENT < alignment)
+            {
+                void *block{upstream->allocate(bytes, alignment)};
+                misses.fetch_add(1, ::std::memory_order_relaxed);
+                bytesInUse.fetch_add(bytes, ::std::memory_order_relaxed);
+                return block;
+            }
+
+            // Reuse a released block of this size class if available
+            SizeClass &sizeClass{sizeClasses[index]};
+            {
+                ::std::lock_guard<::std::mutex> lck{sizeClass.freeBlocks_m};
+                if (!sizeClass.freeBlocks.empty())
+                {
+                    void *block{sizeClass.freeBlocks.back()};
+                    sizeClass.freeBlocks.pop_back();
+                    hits.fetch_add(1, ::std::memory_order_relaxed);
+                    bytesCached.fetch_sub(classSize(index), ::std::memory_order_relaxed);
+                    bytesInUse.fetch_add(classSize(index), ::std::memory_order_relaxed);
+                    return block;
+                }
+            }
+
+            // Otherwise get a new block from upstream
+            void *block{upstream->allocate(classSize(index), BLOCK_ALIGNMENT)};
+            misses.fetch_add(1, ::std::memory_order_relaxed);
+            bytesInUse.fetch_add(classSize(index), ::std::memory_order_relaxed);
+            return block;
+        }
+
+        void do_deallocate(void *block, size_t bytes, size_t alignment) override
+        {
+            // Blocks not fitting into a size class were allocated directly
+            const size_t index{classIndex(bytes)};
+            if (NUMBER_OF_SIZE_CLASSES <= index || BLOCK_ALIGNMENT < alignment)
+            {
+                upstream->deallocate(block, bytes, alignment);
+                bytesInUse.fetch_sub(bytes, ::std::memory_order_relaxed);
+                return;
+            }
+
+            // Keep block for reuse if the cache of this size class is not full
+            bytesInUse.fetch_sub(classSize(index), ::std::memory_order_relaxed);
+            SizeClass &sizeClass{sizeClasses[index]};
+            {
+                ::std::lock_guard<::std::mutex> lck{sizeClass.freeBlocks_m};
+                if (sizeClass.freeBlocks.size() * classSize(index) < MAXIMUM_CACHED_BYTES_PER_CLASS)
+                {
+                    sizeClass.freeBlocks.push_back(block);
+                    bytesCached.fetch_add(classSize(index), ::std::memory_order_relaxed);
+                    return;
+                }
+            }
+            upstream->deallocate(block, classSize(index), BLOCK_ALIGNMENT);
+            return;
+        }
+
+        bool do_is_equal(const ::std::pmr::memory_resource &other) const noexcept override
+        {
+            return this == &other;
+        }
+
+    private:
+        /**
+         * @brief Get the index of the smallest size class fitting the given size (NUMBER_OF_SIZE_CLASSES if too large)
+         *
+         * @param bytes
+         * @return size_t
+         */
+        static size_t classIndex(size_t bytes)
+        {
+            size_t index{0};
+            while (index < NUMBER_OF_SIZE_CLASSES && classSize(index) < bytes)
+                index += 1;
+            return index;
+        }
+
+        /**
+         * @brief Get the block size of a size class
+         *
+         * @param index
+         * @return size_t
+         */
+        static constexpr size_t classSize(size_t index)
+        {
+            return MINIMUM_CLASS_SIZE << index;
+        }
+
+        // Size classes (64 bytes to 1 MiB) and their block alignment
+        static constexpr size_t MINIMUM_CLASS_SIZE{64};
+        static constexpr size_t NUMBER_OF_SIZE_CLASSES{15};
+        static constexpr size_t BLOCK_ALIGNMENT{alignof(::std::max_align_t)};
+
+        // Maximum bytes of released blocks kept per size class (At least one block is kept)
+        static constexpr size_t MAXIMUM_CACHED_BYTES_PER_CLASS{4 * 1024 * 1024};
+
+        // Released blocks of a size class
+        struct SizeClass
+        {
+            ::std::vector<void *> freeBlocks;
+            ::std::mutex freeBlocks_m;
+        };
+        SizeClass sizeClasses[NUMBER_OF_SIZE_CLASSES];
+
+        // Resource to get new blocks from
+        ::std::pmr::memory_resource *upstream;
+
+        // Counters
+        ::std::atomic<uint64_t> hits{0};
+        ::std::atomic<uint64_t> misses{0};
+        ::std::atomic<size_t> bytesInUse{0};
+        ::std::atomic<size_t> bytesCached{0};
+
+        // Disallow copy
+        BufferPool(const BufferPool &) = delete;
+        BufferPool &operator=(const BufferPool &) = delete;
+    };
+}
+
+#endif // BUFFERPOOL_HPP_
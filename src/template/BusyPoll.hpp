@@ -0,0 +1,77 @@
+/**
+ * @file BusyPoll.hpp
+ * @author Nils Henrich
+ * @brief Busy polling of sockets for lowest receive latency.
+ * Instead of sleeping in a blocking read right away, the receive thread spins on the socket for a short budget,
+ * so it doesn't have to be woken up by the scheduler when data arrives soon. This burns a CPU while spinning.
+ * @version 3.2.1
+ * @date 2025-02-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef BUSYPOLL_HPP_
+#define BUSYPOLL_HPP_
+
+#include <vector>
+#include <chrono>
+#include <poll.h>
+#include <sys/socket.h>
+
+namespace tcp
+{
+    /**
+     * @brief Configuration of busy polling
+     */
+    struct BusyPollPolicy
+    {
+        ::std::chrono::microseconds budget{50}; // Time to spin for incoming data before blocking
+        ::std::vector<int> cpus{};              // CPUs the spinning receive threads are pinned to (Empty = Not pinned)
+    };
+
+    /**
+     * @brief Let the kernel busy poll the device queue of a socket on blocking reads (If supported and permitted).
+     * Failures are ignored, as raising the budget above the system default needs the CAP_NET_ADMIN capability.
+     *
+     * @param fd
+     * @param budget
+     */
+    inline void enableSocketBusyPoll(const int fd, const ::std::chrono::microseconds budget)
+    {
+#ifdef SO_BUSY_POLL
+        const int budgetUs{static_cast<int>(budget.count())};
+        setsockopt(fd, SOL_SOCKET, SO_BUSY_POLL, &budgetUs, sizeof(budgetUs));
+#endif // SO_BUSY_POLL
+#ifdef SO_PREFER_BUSY_POLL
+        const int prefer{1};
+        setsockopt(fd, SOL_SOCKET, SO_PREFER_BUSY_POLL, &prefer, sizeof(prefer));
+#endif // SO_PREFER_BUSY_POLL
+        return;
+    }
+
+    /**
+     * @brief Spin until a socket has incoming data (Or is closed) or the budget is used up
+     *
+     * @param fd
+     * @param budget
+     * @return bool (false if the budget is used up without data)
+     */
+    inline bool spinUntilReadable(const int fd, const ::std::chrono::microseconds budget)
+    {
+        const ::std::chrono::steady_clock::time_point end{::std::chrono::steady_clock::now() + budget};
+        struct pollfd socketPoll
+        {
+        };
+        socketPoll.fd = fd;
+        socketPoll.events = POLLIN;
+        do
+        {
+            if (0 != poll(&socketPoll, 1, 0))
+                return true;
+        } while (::std::chrono::steady_clock::now() < end);
+        return false;
+    }
+}
+
+#endif // BUSYPOLL_HPP_
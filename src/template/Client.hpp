@@ -22,12 +22,33 @@
 #include <memory>
 #include <atomic>
 #include <functional>
+#include <future>
+#include <chrono>
+#include <memory_resource>
+#include <mutex>
+#include <condition_variable>
 #include <unistd.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <netdb.h>
+#include <fcntl.h>
+#include <poll.h>
 #include <sys/socket.h>
 #include "exception.hpp"
+#include "Framing.hpp"
+#include "ReceiveBuffer.hpp"
+#include "BufferPool.hpp"
+#include "Message.hpp"
+#include "ReadPause.hpp"
+#include "SpliceForwarder.hpp"
+#include "Resolver.hpp"
+#include "Reconnect.hpp"
+#include "ClientIoContext.hpp"
+#include "Correlation.hpp"
+#include "BusyPoll.hpp"
+#include "Affinity.hpp"
+#include "SocketOptions.hpp"
+#include "SendBatch.hpp"
 
 // Debugging output
 #ifdef DEVELOP
@@ -50,7 +71,9 @@ namespace tcp
         CLIENT_ERROR_START_WRONG_KEY = 35,       // Client could not start because of bad key file or non matching key with certificate
         CLIENT_ERROR_START_CREATE_SOCKET = 40,   // Client could not start because of TCP socket creation error
         CLIENT_ERROR_START_SET_SOCKET_OPT = 41,  // Client could not start because of TCP socket options error
+        CLIENT_ERROR_START_RESOLVE = 42,         // Client could not start because the server address could not be resolved
         CLIENT_ERROR_START_CONNECT = 50,         // Client could not start because of TCP socket connection error
+        CLIENT_ERROR_START_CONNECT_TIMEOUT = 51, // Client could not start because the connection was not established before the connect timeout
         CLIENT_ERROR_START_CONNECT_INIT = 60,    // Client could not start because of an error while initializing the connection
     };
     /**
@@ -97,27 +120,57 @@ namespace tcp
         Client_running_manager &operator=(const Client_running_manager &) = delete;
     };
 
+    /**
+     * @brief Default handler policy for the Client class.
+     * The worker is stored as std::function and can be exchanged at runtime via setWorkOnMessage of the client.
+     *
+     * A custom handler policy can be passed as template parameter to the client instead.
+     * It must provide the following method, that is called directly (and can be inlined) by the client:
+     *  - void message(::std::string msg)     (fragmentation mode)
+     */
+    class ClientCallbacks
+    {
+    public:
+        void message(Message msg)
+        {
+            // Spilled message: Pass the mapping of its file instead of copying it into memory (Dropped if mapping fails)
+            if (msg.isSpilled() && workOnSpilledMessage)
+            {
+                if (const char *content{msg.data()})
+                    workOnSpilledMessage(content, msg.size());
+                return;
+            }
+
+            if (workOnMessage)
+                workOnMessage(::std::move(msg).str());
+        }
+
+        // Pointer to worker function for incoming messages (for fragmentation mode only)
+        ::std::function<void(const ::std::string)> workOnMessage{nullptr};
+
+        // Pointer to worker function for incoming messages spilled to disk (Content is only valid during the call)
+        ::std::function<void(const char *, const size_t)> workOnSpilledMessage{nullptr};
+    };
+
     /**
      * @brief Template class for the Client class.
      *
      * @param SocketType
      * @param SocketDeleter
+     * @param Handler       Handler policy called on incoming messages (Default: Runtime exchangeable std::function worker)
+     * @param Framing       Framing policy separating messages on the stream (Default: Configured at runtime by constructor)
      */
-    template <class SocketType, class SocketDeleter = ::std::default_delete<SocketType>>
+    template <class SocketType, class SocketDeleter = ::std::default_delete<SocketType>, class Handler = ClientCallbacks, class Framing = RuntimeFraming>
     class Client
     {
     public:
         /**
-         * @brief Constructor for continuous stream forwarding
+         * @brief Constructor for continuous stream forwarding (Or for the fixed framing of a compile-time framing policy)
          *
          * @param os    Stream to forward incoming stream to
          */
         Client(::std::ostream &os) : CONTINUOUS_OUTPUT_STREAM{os},
-                                     DELIMITER_FOR_FRAGMENTATION{0},
-                                     APPEND_STRING_FOR_FRAGMENTATION{0},
-                                     APPEND_STRING_FOR_FRAGMENTATION_LENGTH{0},
-                                     MAXIMUM_MESSAGE_LENGTH_FOR_FRAGMENTATION{0},
-                                     MESSAGE_FRAGMENTATION_ENABLED{false} {}
+                                     framing{} {}
 
         /**
          * @brief Constructor for fragmented messages
@@ -127,24 +180,86 @@ namespace tcp
          * @param messageMaxLen Maximum message length (actual message + length of append string)
          */
         Client(char delimiter, const ::std::string &messageAppend, size_t messageMaxLen) : CONTINUOUS_OUTPUT_STREAM{nullstream},
-                                                                                           DELIMITER_FOR_FRAGMENTATION{delimiter},
-                                                                                           APPEND_STRING_FOR_FRAGMENTATION{messageAppend},
-                                                                                           APPEND_STRING_FOR_FRAGMENTATION_LENGTH{messageAppend.size()},
-                                                                                           MAXIMUM_MESSAGE_LENGTH_FOR_FRAGMENTATION{messageMaxLen},
-                                                                                           MESSAGE_FRAGMENTATION_ENABLED{true} {} // TODO: Add check if messageAppend is too long (more than messageMaxLen bytes)
+                                                                                           framing{delimiter, messageAppend, messageMaxLen} {}
 
         virtual ~Client() {}
 
         /**
          * @brief Start the client and connects to the server.
+         * The server address is resolved with getaddrinfo (IPv4 and IPv6, through the resolver cache if set)
+         * and all resolved addresses are tried in order until a connection is established or the connect timeout is reached.
          * If connection to server succeeds, this method returns CLIENT_START_OK, otherwise it returns an error code.
          *
-         * @param serverIp
+         * @param serverIp  Host name or IP address of the server
          * @param serverPort
          * @return int
          */
         int start(const ::std::string &serverIp, const int serverPort);
 
+        /**
+         * @brief Start the client in a separate thread, so many clients can connect in parallel.
+         * The future gets the return code of start.
+         * The client must not be used until the future is ready.
+         *
+         * @param serverIp  Host name or IP address of the server
+         * @param serverPort
+         * @return future<int>
+         */
+        ::std::future<int> startAsync(const ::std::string &serverIp, const int serverPort);
+
+        /**
+         * @brief Set the maximum time to establish the TCP connection when starting (Default: 0 = Wait as long as the operating system does).
+         * The timeout covers all resolved addresses together.
+         *
+         * @param timeout
+         */
+        void setConnectTimeout(const ::std::chrono::milliseconds timeout);
+
+        /**
+         * @brief Set a cache for resolved server addresses (Default: nullptr = Resolve on every start).
+         * The same cache can be shared by many clients.
+         *
+         * @param cache
+         */
+        void setResolverCache(::std::shared_ptr<ResolverCache> cache);
+
+        /**
+         * @brief Reconnect automatically with exponential backoff and jitter if the connection to the server is lost.
+         * The address the client is connected to is used again without resolving the server address.
+         * TLS clients resume the last session if the server still knows it.
+         * While reconnecting, the client is not running (Messages can't be sent) and a read pause is reset.
+         * Stopping the client aborts reconnecting.
+         *
+         * @param policy
+         */
+        void setReconnectPolicy(const ReconnectPolicy &policy);
+
+        /**
+         * @brief Don't reconnect if the connection to the server is lost (Default).
+         */
+        void disableReconnect();
+
+        /**
+         * @brief Set worker executed after reconnecting.
+         * It gets true and the number of attempts needed if the client is connected again,
+         * or false and the number of attempts made if the maximum number of attempts is reached without success.
+         * The worker runs in the receive thread.
+         *
+         * @param worker
+         */
+        void setWorkOnReconnect(::std::function<void(const bool, const unsigned int)> worker);
+
+        /**
+         * @brief Attach the connection to a shared I/O context instead of running an own receive thread (Default: nullptr = Own receive thread).
+         * The workers of the context read the incoming data and run the message worker directly (No thread per message),
+         * so many clients can share a fixed number of threads. Workers should return quickly and may stop their own client.
+         * The same context can be shared by many clients and must outlive them.
+         * Takes effect on the next start of the client.
+         *
+         * @param context
+         */
+        void setIoContext(::std::shared_ptr<ClientIoContext> context);
+
         /**
          * @brief Stop the client and disconnects from the server.
          */
@@ -159,6 +274,38 @@ namespace tcp
          */
         bool sendMsg(const ::std::string &msg);
 
+        /**
+         * @brief Open a batch for messages to the server.
+         * All messages sent until flush (From any thread) are collected and written together,
+         * so they go out in full-sized segments and TLS records. Large batches are written in parts early.
+         * A batch left open doesn't send anything, so use the SendBatch guard where possible.
+         *
+         * @return bool (false if the client is not running)
+         */
+        bool beginBatch();
+
+        /**
+         * @brief Write all collected messages and close the batch
+         *
+         * @return bool (false if writing failed, true if no batch was open)
+         */
+        bool flush();
+
+        /**
+         * @brief Send a request to the server and get a future for its response (Fragmentation mode only).
+         * The message is sent with a header containing a unique request ID, the server answers with reply.
+         * Many requests can be in flight on the connection at the same time and responses can arrive in any order.
+         * Responses are passed to the futures directly by the receive thread and never to the message worker.
+         * Incoming messages are only checked for responses after the first request, so a client without requests gets all messages.
+         * The future fails with Request_error if the request can't be sent, no response arrives within the timeout,
+         * the connection is lost before or message stream workers are set (see setWorkOnMessageStream).
+         *
+         * @param msg
+         * @param timeout   Maximum time to wait for the response
+         * @return future<string>
+         */
+        ::std::future<::std::string> request(const ::std::string &msg, const ::std::chrono::milliseconds timeout);
+
         /**
          * @brief Set worker executed on each incoming message in fragmentation mode
          *
@@ -166,6 +313,195 @@ namespace tcp
          */
         void setWorkOnMessage(::std::function<void(const ::std::string)> worker);
 
+        /**
+         * @brief Run the message worker directly in the receive thread instead of a new thread per message (Default: false).
+         * This saves starting a thread for each message and keeps messages in order, but the worker must not block:
+         * No data is read from the server while it runs. Takes effect on the next connection.
+         *
+         * @param enabled
+         */
+        void setInlineMessageWork(const bool enabled);
+
+        /**
+         * @brief Spin on the socket for incoming data before blocking in a read (Default: disabled).
+         * The receive thread doesn't sleep while data arrives within the budget, which saves the wake up latency,
+         * but it burns a CPU while spinning. The kernel busy polls the socket as well if supported and permitted.
+         * The receive thread is pinned to the CPUs of the policy. Not used if attached to a shared I/O context.
+         * Takes effect on the next connection.
+         *
+         * @param policy
+         */
+        void setBusyPoll(const BusyPollPolicy &policy);
+
+        /**
+         * @brief Block in reads right away (Default).
+         */
+        void disableBusyPoll();
+
+        /**
+         * @brief Pin the receive and worker threads to CPUs (Default: Not pinned).
+         * The receive thread can follow the CPU the kernel processes the data of the connection on. The CPUs of a busy poll policy take precedence.
+         * Not used for the receive thread if attached to a shared I/O context (Its workers are pinned with its constructor).
+         * Takes effect on the next connection.
+         *
+         * @param affinity
+         */
+        void setThreadAffinity(const ThreadAffinity &affinity);
+
+        /**
+         * @brief Set the options of the connection socket (Default: Reuse address only).
+         * Takes effect on the next start. The backlog is not used.
+         *
+         * @param options
+         */
+        void setSocketOptions(const SocketOptions &options);
+
+        /**
+         * @brief Set a fixed size for the receive buffer (Default: 16384 bytes).
+         * Larger chunks need fewer reads for bulk transfers, smaller chunks save memory.
+         * Takes effect on the next start of the client. Throw Client_error if size is 0.
+         *
+         * @param chunkSize
+         */
+        void setReceiveChunkSize(const size_t chunkSize);
+
+        /**
+         * @brief Let the receive buffer adapt its size to the observed reads.
+         * The buffer starts with the minimum size, grows when reads fill it completely and shrinks when reads stay small.
+         * Takes effect on the next start of the client. Throw Client_error if minimum size is 0 or greater than maximum size.
+         *
+         * @param minChunkSize
+         * @param maxChunkSize
+         */
+        void setReceiveChunkSizeAdaptive(const size_t minChunkSize, const size_t maxChunkSize);
+
+        /**
+         * @brief Set the memory resource receive buffers are taken from (Default: new/delete).
+         * Released buffers are kept in a size-classed pool of this client and only new ones are requested from this resource.
+         * Must be called while no connection is running. Throw Error if buffers are still in use.
+         *
+         * @param resource
+         */
+        void setMemoryResource(::std::pmr::memory_resource *resource);
+
+        /**
+         * @brief Get the counters of the receive buffer pool (Hits, misses, bytes in use and bytes cached)
+         *
+         * @return BufferPoolStats
+         */
+        BufferPoolStats getBufferPoolStats() const;
+
+        /**
+         * @brief Set worker executed when an incoming message exceeds the maximum message length in fragmentation mode.
+         * The message is dropped and its remaining data is skipped until the next delimiter, so it is never buffered completely.
+         * The worker runs in the receive thread and should return quickly.
+         *
+         * @param worker
+         */
+        void setWorkOnOversizedMessage(::std::function<void()> worker);
+
+        /**
+         * @brief Spill incoming messages to disk while reassembling them once they exceed a threshold in fragmentation mode.
+         * A spilled message is written to an unlinked temporary file in the given directory instead of growing in memory.
+         * A handler policy taking the message type gets a read-only mapping of this file (see BasicMessage::view()),
+         * so does the worker set by setWorkOnSpilledMessage. Without this worker, the string based worker still gets a copy in memory.
+         * If writing fails, the message is dropped.
+         * Takes effect for messages received afterwards. A threshold of 0 disables spilling (Default).
+         *
+         * @param threshold
+         * @param directory
+         */
+        void setSpillToDisk(const size_t threshold, const ::std::string &directory = "/var/tmp");
+
+        /**
+         * @brief Set worker executed on each incoming message spilled to disk (see setSpillToDisk) instead of the message worker.
+         * The worker gets a read-only mapping of the spill file, so the message is never copied into memory.
+         * The content is only valid during the call. If mapping fails, the message is dropped.
+         *
+         * @param worker
+         */
+        void setWorkOnSpilledMessage(::std::function<void(const char *, const size_t)> worker);
+
+        /**
+         * @brief Get the number of incoming messages dropped for exceeding the maximum message length
+         *
+         * @return uint64_t
+         */
+        uint64_t getOversizedMessageCount() const;
+
+        /**
+         * @brief Set workers receiving incoming messages in fragmentation mode piece by piece while they arrive (Instead of the message worker).
+         * Large messages are never buffered completely, so memory stays constant and processing overlaps with the transfer.
+         * All workers run in the receive thread in message order.
+         * The chunk data is only valid during the call of the chunk worker.
+         * The end worker gets true if the message is complete, or false if it is dropped for exceeding the maximum message length or the connection is closed.
+         * Passing no chunk worker switches back to delivering whole messages.
+         *
+         * @param begin Worker called before the first chunk of a message (Optional)
+         * @param chunk Worker called for each received part of a message
+         * @param end   Worker called after the last chunk of a message (Optional)
+         */
+        void setWorkOnMessageStream(::std::function<void()> begin,
+                                    ::std::function<void(const char *, const size_t)> chunk,
+                                    ::std::function<void(const bool)> end);
+
+        /**
+         * @brief Set worker getting the raw incoming data in continuous mode instead of the forward stream.
+         * The data is passed as received, without going through an ostream and without flushing per chunk.
+         * With a batch size, several reads are collected and passed at once until the batch size is reached
+         * or no more data is waiting, so the worker is called less often without delaying data.
+         * The data is only valid during the call. The worker runs in the receive thread.
+         * Takes effect for data received afterwards. Passing no worker switches back to the forward stream.
+         *
+         * @param worker
+         * @param batchSize Minimum number of bytes per call while more data is waiting (Default: 0 = Pass each read directly)
+         */
+        void setWorkOnData(::std::function<void(const char *, const size_t)> worker, const size_t batchSize = 0);
+
+        /**
+         * @brief Stop reading from the server until resumeReading is called.
+         * Data not read stays in the kernel receive buffer, so the TCP receive window throttles the server instead of the client buffering it.
+         * A slow consumer (e.g. the data worker) can call this to signal that it would block and resume from another thread once it caught up.
+         * Takes effect before the next read (A read already waiting for data still completes). While reading is paused, a closed connection is only noticed after resuming.
+         *
+         * @return bool (true if client is running, false if not)
+         */
+        bool pauseReading();
+
+        /**
+         * @brief Set a file descriptor to forward the incoming data to in continuous mode (-1 for no forwarding).
+         * The data is moved from the socket to the file descriptor with splice(2) through a pipe, so it never enters user space.
+         * If splicing is not supported by the file descriptor (e.g. a file opened with O_APPEND), the data is copied with read and write instead.
+         * Used instead of the data worker and the forward stream. Only supported by unencrypted TCP clients, ignored otherwise.
+         * The file descriptor is not closed by the client. If writing to it fails, the connection is closed.
+         * Takes effect on the next start of the client.
+         *
+         * @param fd
+         */
+        void setSpliceTarget(const int fd);
+
+        /**
+         * @brief Get the number of bytes forwarded to the splice target, moved with splice and copied as fallback
+         *
+         * @return SpliceStats
+         */
+        SpliceStats getSpliceStats() const;
+
+        /**
+         * @brief Continue reading from the server paused by pauseReading
+         *
+         * @return bool (true if client is running, false if not)
+         */
+        bool resumeReading();
+
+        /**
+         * @brief Get the handler policy called on incoming messages.
+         * Can be used to configure a custom handler policy before starting the client.
+         *
+         * @return Handler&
+         */
+        Handler &getHandler();
+
         /**
          * @brief Return if client is running
          *
@@ -197,13 +533,52 @@ namespace tcp
         virtual void connectionDeinit() = 0;
 
         /**
-         * @brief Read raw received data from the server connection.
-         * This method is expected to return the received data as a string with blocking read (Empty string means failure).
+         * @brief Read raw received data from the server connection into a given buffer.
+         * This method is expected to block until data is available and return the number of bytes read (0 or less means failure).
+         * The buffer is owned by the receive thread and reused for every read, so it is not zeroed.
          * This method is abstract and must be implemented by derived classes.
          *
-         * @return string
+         * @param buffer    Buffer to read into
+         * @param size      Size of the buffer
+         * @return ssize_t
+         */
+        virtual ssize_t readMsg(char *buffer, size_t size) = 0;
+
+        /**
+         * @brief Check if the socket carries the plain data, so it can be spliced to a file descriptor directly.
+         * Not supported by default, derived classes for unencrypted connections override this.
+         *
+         * @return bool
+         */
+        virtual bool spliceSupported() const { return false; }
+
+        /**
+         * @brief Check if a failed read found no data yet, but the connection is still open.
+         * This is the case if the non-blocking socket of a shared I/O context has no data (Default),
+         * derived classes for encrypted connections also check for protocol data (e.g. a TLS session ticket) or an incomplete record.
+         * Called directly after readMsg returned 0 or less.
+         *
+         * @param result    Return value of readMsg
+         * @return bool
+         */
+        virtual bool readWouldBlock(const ssize_t result) { return 0 > result && (EAGAIN == errno || EWOULDBLOCK == errno); }
+
+        /**
+         * @brief Wait until the socket is ready for the given events (poll(2) events).
+         * Used to go on writing when the non-blocking socket of a shared I/O context can't take more data at the moment.
+         *
+         * @param events
+         * @return bool (false if polling fails)
+         */
+        bool waitForSocket(const short events) const;
+
+        /**
+         * @brief Check if the connection buffered data that is already read from the socket, so no new data is signaled for it.
+         * Never by default, derived classes for encrypted connections override this.
+         *
+         * @return bool
          */
-        virtual ::std::string readMsg() = 0;
+        virtual bool pendingData() const { return false; }
 
         /**
          * @brief Write raw data to the server connection.
@@ -216,161 +591,384 @@ namespace tcp
          */
         virtual bool writeMsg(const ::std::string &msg) = 0;
 
+        /**
+         * @brief Write collected messages of a batch to the server connection.
+         * Same as writeMsg by default, derived classes can hold back a partly filled segment if more data follows.
+         *
+         * @param data
+         * @param more  More data of the batch follows
+         * @return bool
+         */
+        virtual bool writeBatch(const ::std::string &data, const bool) { return writeMsg(data); }
+
         // Client sockets (TCP and user defined)
-        int tcpSocket;
+        int tcpSocket{-1};
         ::std::unique_ptr<SocketType, SocketDeleter> clientSocket{nullptr};
 
-        // Maximum package size for receiving data
-        const static int MAXIMUM_RECEIVE_PACKAGE_SIZE{16384};
-
     private:
+        // Message type passed to the handler policy (Inline storage for small messages)
+        using MessageType = typename HandlerMessageType<Handler>::type;
+
         /**
-         * @brief Read incoming data from the server connection.
+         * @brief Read incoming data from the server connection and reconnect if it is lost (If enabled).
          * This method runs infinitely until the client is stopped.
          */
         void receive();
 
-        // Flag to indicate if the client is running
-        RunningFlag running{false};
-
-        // Client socket address
-        struct sockaddr_in socketAddress
+        // State of the message currently streamed on a connection
+        struct MessageStreamState
         {
+            bool inMessage{false};
+            bool skipping{false};
+            size_t length{0};
         };
 
-        // Thread for receiving data from the server
-        ::std::thread recHandler{};
+        // State of receiving from the current connection
+        struct ReceiveState
+        {
+            ReceiveState(const size_t minChunkSize, const size_t maxChunkSize, BufferPool *pool, const size_t batchSize, const bool inlineDelivery) : receiveBuffer{minChunkSize, maxChunkSize, pool},
+                                                                                                                                                     batchSize{batchSize},
+                                                                                                                                                     dataBatch{pool},
+                                                                                                                                                     inlineDelivery{inlineDelivery} {}
 
-        // All working threads and their running status
-        ::std::vector<::std::thread> workHandlers;
-        ::std::vector<::std::unique_ptr<RunningFlag>> workHandlersRunning;
+            // Receive buffer reused for all reads (Not zeroed, only the read bytes are used)
+            ReceiveBuffer receiveBuffer;
 
-        // Pointer to worker function for incoming messages (for fragmentation mode only)
-        ::std::function<void(const ::std::string)> workOnMessage{nullptr};
+            // Message reassembled at the moment
+            // If a message exceeds the maximum length, its remaining data is skipped until the next delimiter
+            MessageType buffer{};
+            bool skipOversized{false};
 
-        // Out stream to forward continuous input stream to
-        ::std::ostream &CONTINUOUS_OUTPUT_STREAM;
+            // State of the message currently streamed (Only used if messages are streamed)
+            MessageStreamState streamState{};
 
-        // Delimiter for the message framing (incoming and outgoing) (default is '\n')
-        const char DELIMITER_FOR_FRAGMENTATION;
+            // Raw data collected for the data worker (Only used in continuous mode with a batch size)
+            const size_t batchSize;
+            ::std::pmr::vector<char> dataBatch;
 
-        // Append this string to the end of each outgoing fragmented message
-        const ::std::string APPEND_STRING_FOR_FRAGMENTATION;
-        const size_t APPEND_STRING_FOR_FRAGMENTATION_LENGTH;
+            // Forwarder of incoming data to the splice target (Only used in continuous mode on unencrypted connections)
+            ::std::unique_ptr<SpliceForwarder> spliceForwarder{nullptr};
 
-        // Maximum message length (incoming and outgoing)
-        const size_t MAXIMUM_MESSAGE_LENGTH_FOR_FRAGMENTATION;
+            // Run the handler directly instead of a thread per message (Used by workers of a shared I/O context)
+            const bool inlineDelivery;
 
-        // Flag if messages shall be fragmented
-        const bool MESSAGE_FRAGMENTATION_ENABLED;
+            // CPUs of the message workers of this connection (Empty = Not pinned)
+            ::std::vector<int> workerCpus{};
+        };
 
-        // Buffer/Stream doing nothing
-        NullBuffer nullbuffer;
-        ::std::ostream nullstream{&nullbuffer};
+        /**
+         * @brief Create the receive state for the current connection
+         *
+         * @param inlineDelivery
+         * @return ReceiveState*
+         */
+        ReceiveState *newReceiveState(const bool inlineDelivery);
 
-        // Disallow copy
-        Client() = delete;
-        Client(const Client &) = delete;
-        Client &operator=(const Client &) = delete;
-    };
+        /**
+         * @brief Read incoming data from the current server connection until it is closed.
+         *
+         * @return bool (true if the connection is lost, false if the client is stopped)
+         */
+        bool receiveConnection();
 
-    // ============================== Implementation of non-abstract methods. ==============================
-    // ====================== Must be in header file because of the template class. =======================
+        /**
+         * @brief Read incoming data signaled by the shared I/O context (Called by its workers).
+         *
+         * @return IoContinuation
+         */
+        IoContinuation receiveReady();
 
-    template <class SocketType, class SocketDeleter>
-    int Client<SocketType, SocketDeleter>::start(const ::std::string &serverIp, const int serverPort)
-    {
-        // Check if client is already running
-        // If so, return with error
-        if (running)
-        {
-#ifdef DEVELOP
-            ::std::cerr << DEBUGINFO << ": Client already running" << ::std::endl;
-#endif // DEVELOP
+        /**
+         * @brief Read incoming data once and process it.
+         * This method blocks until data is received.
+         *
+         * @param state
+         * @return bool (false if the connection is closed)
+         */
+        bool receiveStep(ReceiveState &state);
 
-            return -1;
-        }
+        /**
+         * @brief Clean up a closed connection (Wait for message handlers, pass remaining data and close the TCP socket)
+         *
+         * @param state
+         * @return bool (true if the connection is lost, false if the client is stopped)
+         */
+        bool endConnection(ReceiveState &state);
 
-        // Check if the port number is valid
-        if (1 > serverPort || 65535 < serverPort)
-        {
-#ifdef DEVELOP
-            ::std::cerr << DEBUGINFO << ": The port " << serverPort << " couldn't be used" << ::std::endl;
-#endif // DEVELOP
+        /**
+         * @brief Attach the current connection to the shared I/O context
+         *
+         * @return bool (false if attaching failed)
+         */
+        bool attachIo();
 
-            return CLIENT_ERROR_START_WRONG_PORT;
-        }
+        /**
+         * @brief Detach the current connection from the shared I/O context.
+         * If called by a message worker run by the context, the connection is cleaned up by its reader after the worker returns.
+         *
+         * @return bool (false if called by a message worker run by the context)
+         */
+        bool detachIo();
 
-        // Initialize the client
-        // If initialization fails, return with error
-        int initCode{init()};
-        if (initCode)
-            return initCode;
+        /**
+         * @brief Reconnect to the address of the lost connection following the reconnect policy.
+         *
+         * @return bool (true if the client is connected again, false if stopped or the maximum number of attempts is reached)
+         */
+        bool reconnect();
 
-        // Create the client tcp socket and connect to the server
-        // If socket creation fails, stop client and return with error
-        tcpSocket = socket(AF_INET, SOCK_STREAM, 0);
-        if (-1 == tcpSocket)
-        {
-#ifdef DEVELOP
-            ::std::cerr << DEBUGINFO << ": Error while creating client TCP socket" << ::std::endl;
-#endif // DEVELOP
+        /**
+         * @brief Connect to the first reachable server address and initialize the connection.
+         * The TCP socket is closed again if this fails.
+         *
+         * @param addresses
+         * @return int (CLIENT_START_OK or error code)
+         */
+        int connectToServer(const ::std::vector<ResolvedAddress> &addresses);
 
-            stop();
-            return CLIENT_ERROR_START_CREATE_SOCKET;
-        }
+        /**
+         * @brief Count and report an incoming message exceeding the maximum message length
+         */
+        void reportOversizedMessage();
 
-        // Set the socket options
-        // If setting fails, stop client and return with error
-        int opt{0};
-        if (setsockopt(tcpSocket, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt)))
-        {
-#ifdef DEVELOP
-            ::std::cerr << DEBUGINFO << ": Error while setting TCP socket options" << ::std::endl;
-#endif // DEVELOP
+        /**
+         * @brief Append a received part to the message buffer (Spill the message to disk if it exceeds the spill threshold)
+         *
+         * @param buffer
+         * @param part
+         * @param len
+         * @return bool (False if the message could not be stored and is dropped)
+         */
+        bool appendMessagePart(MessageType &buffer, const char *part, const size_t len);
 
-            stop();
-            return CLIENT_ERROR_START_SET_SOCKET_OPT;
-        }
+        /**
+         * @brief Pass a received part of a message to the streaming workers (Begin the message if it is the first part)
+         *
+         * @param part
+         * @param len
+         * @param state
+         */
+        void streamMessagePart(const char *part, const size_t len, MessageStreamState &state);
 
-        // Initialize the socket address
-        struct hostent *serverHost;
-        serverHost = gethostbyname(serverIp.c_str());
-        memset(&socketAddress, 0, sizeof(socketAddress));
-        socketAddress.sin_family = AF_INET;
-        socketAddress.sin_addr.s_addr = *(uint32_t *)serverHost->h_addr_list[0];
-        socketAddress.sin_port = htons(serverPort);
+        /**
+         * @brief End the message currently streamed (At a delimiter or if the connection is closed)
+         *
+         * @param state
+         * @param complete  True at a delimiter, false if the connection is closed
+         */
+        void streamMessageEnd(MessageStreamState &state, const bool complete);
 
-        // Connect to the server via unencrypted TCP
-        // If connection fails, stop client and return with error
-        if (connect(tcpSocket, (struct sockaddr *)&socketAddress, sizeof(socketAddress)))
+        /**
+         * @brief Connect the TCP socket to an address without blocking longer than the deadline (If a connect timeout is set)
+         *
+         * @param address
+         * @param deadline
+         * @return int (CLIENT_START_OK, CLIENT_ERROR_START_CONNECT or CLIENT_ERROR_START_CONNECT_TIMEOUT)
+         */
+        int connectWithDeadline(const ResolvedAddress &address, const ::std::chrono::steady_clock::time_point deadline);
+
+        /**
+         * @brief Pass a received message to its waiting request if it is a response
+         *
+         * @param buffer
+         * @return bool (false if the message is no response to a waiting request)
+         */
+        bool completeRequest(MessageType &buffer);
+
+        // Flag to indicate if the client is running
+        RunningFlag running{false};
+
+        // Address of the connected server
+        ResolvedAddress serverAddress{};
+
+        // Maximum time to establish the TCP connection (0 = No timeout) and cache for resolved addresses
+        ::std::chrono::milliseconds connectTimeout{0};
+        ::std::shared_ptr<ResolverCache> resolverCache{nullptr};
+
+        // Reconnect configuration (Only used if enabled) and worker executed after reconnecting
+        bool reconnectEnabled{false};
+        ReconnectPolicy reconnectPolicy{};
+        ::std::function<void(const bool, const unsigned int)> workOnReconnect{nullptr};
+
+        // Flag to indicate if the client is reconnecting at the moment
+        RunningFlag reconnecting{false};
+
+        // Connection sockets are exchanged by the receive thread on reconnect and blocked by stop
+        // Stop request to abort reconnecting (Waiting for the next attempt is interrupted)
+        ::std::mutex connection_m{};
+        ::std::condition_variable reconnectWait{};
+        bool stopRequested{false};
+
+        // Thread for receiving data from the server (Or for reconnecting if attached to a shared I/O context)
+        ::std::thread recHandler{};
+
+        // Shared I/O context to attach to on start, context the current connection is attached to, its registration and receive state
+        ::std::shared_ptr<ClientIoContext> ioContext{nullptr};
+        ::std::shared_ptr<ClientIoContext> attachedIoContext{nullptr};
+        uint64_t ioRegistration{0};
+        ::std::unique_ptr<ReceiveState> ioState{nullptr};
+        ::std::mutex io_m{};
+
+        // Run the message worker in the receive thread (No thread per message)
+        bool inlineMessageWork{false};
+
+        // Busy poll configuration (Only used if enabled)
+        bool busyPollEnabled{false};
+        BusyPollPolicy busyPollPolicy{};
+
+        // CPUs of receive and worker threads
+        ThreadAffinity threadAffinity{};
+
+        // Options of the connection socket
+        SocketOptions socketOptions{};
+
+        // Messages collected while a batch is open
+        ::std::atomic<bool> batching{false};
+        ::std::string sendBatch{};
+        ::std::mutex sendBatch_m{};
+
+        // All working threads and their running status
+        ::std::vector<::std::thread> workHandlers;
+        ::std::vector<::std::unique_ptr<RunningFlag>> workHandlersRunning;
+
+        // Size bounds of the receive buffer (Equal for fixed size)
+        size_t receiveChunkSizeMin{DEFAULT_RECEIVE_CHUNK_SIZE};
+        size_t receiveChunkSizeMax{DEFAULT_RECEIVE_CHUNK_SIZE};
+
+        // Pool the receive buffers are allocated from
+        BufferPool bufferPool{};
+
+        // Worker and counter for incoming messages exceeding the maximum message length
+        ::std::function<void()> workOnOversizedMessage{nullptr};
+        ::std::atomic<uint64_t> oversizedMessages{0};
+
+        // Message size from which incoming messages are spilled to disk (0 = Disabled) and directory for the spill files
+        size_t spillThreshold{0};
+        ::std::string spillDirectory{};
+
+        // Workers for streaming delivery of incoming messages (Used instead of the message worker if a chunk worker is set)
+        ::std::function<void()> workOnMessageBegin{nullptr};
+        ::std::function<void(const char *, const size_t)> workOnMessageChunk{nullptr};
+        ::std::function<void(const bool)> workOnMessageEnd{nullptr};
+
+        // Worker for raw incoming data in continuous mode (Used instead of the forward stream if set) and its batch size
+        ::std::function<void(const char *, const size_t)> workOnData{nullptr};
+        size_t dataBatchSize{0};
+
+        // Read pause state of the connection
+        ReadPause readPause{};
+
+        // Requests waiting for their responses
+        PendingRequests pendingRequests{};
+        ::std::atomic_bool requestsSent{false};
+
+        // File descriptor to forward incoming data to and forwarding counters
+        int spliceTarget{-1};
+        ::std::atomic<uint64_t> splicedBytes{0};
+        ::std::atomic<uint64_t> copiedBytes{0};
+
+        // Handler policy called on incoming messages
+        Handler handler{};
+
+        // Out stream to forward continuous input stream to
+        ::std::ostream &CONTINUOUS_OUTPUT_STREAM;
+
+        // Framing policy (Delimiter, append string and maximum length of messages)
+        const Framing framing;
+
+        // Buffer/Stream doing nothing
+        NullBuffer nullbuffer;
+        ::std::ostream nullstream{&nullbuffer};
+
+        // Disallow copy
+        Client() = delete;
+        Client(const Client &) = delete;
+        Client &operator=(const Client &) = delete;
+    };
+
+    // ============================== Implementation of non-abstract methods. ==============================
+    // ====================== Must be in header file because of the template class. =======================
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    int Client<SocketType, SocketDeleter, Handler, Framing>::start(const ::std::string &serverIp, const int serverPort)
+    {
+        // Check if client is already running (Or reconnecting)
+        // If so, return with error
+        if (running || reconnecting)
         {
 #ifdef DEVELOP
-            ::std::cerr << DEBUGINFO << ": Error while connecting to server" << ::std::endl;
+            ::std::cerr << DEBUGINFO << ": Client already running" << ::std::endl;
+#endif // DEVELOP
+
+            return -1;
+        }
+
+        // Check if the port number is valid
+        if (1 > serverPort || 65535 < serverPort)
+        {
+#ifdef DEVELOP
+            ::std::cerr << DEBUGINFO << ": The port " << serverPort << " couldn't be used" << ::std::endl;
+#endif // DEVELOP
+
+            return CLIENT_ERROR_START_WRONG_PORT;
+        }
+
+        // Clear stop request of the last run
+        {
+            ::std::lock_guard<::std::mutex> lck{connection_m};
+            stopRequested = false;
+        }
+
+        // Initialize the client
+        // If initialization fails, return with error
+        int initCode{init()};
+        if (initCode)
+            return initCode;
+
+        // Resolve the server address (Through the resolver cache if set)
+        // If resolution fails, stop client and return with error
+        ::std::vector<ResolvedAddress> addresses;
+        if (!(resolverCache ? resolverCache->resolve(serverIp, serverPort, addresses) : resolveAddresses(serverIp, serverPort, addresses)))
+        {
+#ifdef DEVELOP
+            ::std::cerr << DEBUGINFO << ": Unable to resolve server address " << serverIp << ::std::endl;
 #endif // DEVELOP
 
             stop();
-            return CLIENT_ERROR_START_CONNECT;
+            return CLIENT_ERROR_START_RESOLVE;
         }
 
-        // Initialize the TCP connection to the server
-        // If initialization fails, stop client and return with error
-        clientSocket.reset(connectionInit());
-        if (!clientSocket.get())
+        // Connect to the server and initialize the connection
+        // If connection fails, stop client and return with error
+        const int connectCode{connectToServer(addresses)};
+        if (CLIENT_START_OK != connectCode)
         {
             stop();
-            return CLIENT_ERROR_START_CONNECT_INIT;
+            return connectCode;
         }
 
         // Receive incoming data from the server infinitely in the background while the client is running
         // If background task already exists, return with error
+        // Client is running before the receive thread starts, so a connection lost immediately is noticed
         if (recHandler.joinable())
             throw Client_error("Error while starting background receive task. Background task already exists");
-        recHandler = ::std::thread{&Client::receive, this};
-
-        // Client is now running
+        readPause.reset();
         running = true;
 
+        // Attach to the shared I/O context if set instead
+        // If attaching fails, stop client and return with error
+        attachedIoContext = ioContext;
+        if (attachedIoContext)
+        {
+            if (!attachIo())
+            {
+                stop();
+                return CLIENT_ERROR_START_CONNECT_INIT;
+            }
+        }
+        else
+            recHandler = ::std::thread{&Client::receive, this};
+
 #ifdef DEVELOP
         ::std::cout << DEBUGINFO << ": Client started" << ::std::endl;
 #endif // DEVELOP
@@ -378,26 +976,98 @@ namespace tcp
         return CLIENT_START_OK;
     }
 
-    template <class SocketType, class SocketDeleter>
-    void Client<SocketType, SocketDeleter>::stop()
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    ::std::future<int> Client<SocketType, SocketDeleter, Handler, Framing>::startAsync(const ::std::string &serverIp, const int serverPort)
+    {
+        return ::std::async(::std::launch::async, [this, serverIp, serverPort]()
+                            { return start(serverIp, serverPort); });
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Client<SocketType, SocketDeleter, Handler, Framing>::setConnectTimeout(const ::std::chrono::milliseconds timeout)
+    {
+        connectTimeout = timeout;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Client<SocketType, SocketDeleter, Handler, Framing>::setResolverCache(::std::shared_ptr<ResolverCache> cache)
+    {
+        resolverCache = cache;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Client<SocketType, SocketDeleter, Handler, Framing>::setReconnectPolicy(const ReconnectPolicy &policy)
+    {
+        reconnectPolicy = policy;
+        reconnectEnabled = true;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Client<SocketType, SocketDeleter, Handler, Framing>::disableReconnect()
+    {
+        reconnectEnabled = false;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Client<SocketType, SocketDeleter, Handler, Framing>::setWorkOnReconnect(::std::function<void(const bool, const unsigned int)> worker)
+    {
+        workOnReconnect = worker;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Client<SocketType, SocketDeleter, Handler, Framing>::setIoContext(::std::shared_ptr<ClientIoContext> context)
+    {
+        ioContext = context;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Client<SocketType, SocketDeleter, Handler, Framing>::stop()
     {
         // Stop the client
         running = false;
 
-        // Block the TCP socket to abort receiving process
-        connectionDeinit();
-        int shut{shutdown(tcpSocket, SHUT_RDWR)};
+        // Abort reconnecting and block the TCP socket to abort receiving process (Or a connection attempt)
+        {
+            ::std::lock_guard<::std::mutex> lck{connection_m};
+            stopRequested = true;
+            connectionDeinit();
+            shutdown(tcpSocket, SHUT_RDWR);
+        }
+        reconnectWait.notify_all();
 
-        // Wait for the background receive thread to finish
-        if (recHandler.joinable())
-            recHandler.join();
+        // Don't let a paused receive thread wait forever
+        readPause.close();
+
+        // Detach from the shared I/O context and wait for the background receive (Or reconnect) thread to finish
+        const bool detached{detachIo()};
+        ::std::thread finished{};
+        {
+            ::std::lock_guard<::std::mutex> lck{io_m};
+            finished = ::std::move(recHandler);
+        }
+        if (finished.joinable())
+            finished.join();
 
-        // If shutdown failed, abort stop here
-        if (shut)
+        // Stopped by a message worker run by the shared I/O context: The reader closes the connection after the worker returns
+        if (!detached)
             return;
+        ioState.reset();
 
         // Close the TCP socket
-        close(tcpSocket);
+        // If already closed by the receive thread, abort stop here
+        {
+            ::std::lock_guard<::std::mutex> lck{connection_m};
+            if (0 > tcpSocket)
+                return;
+            close(tcpSocket);
+            tcpSocket = -1;
+        }
 
 #ifdef DEVELOP
         ::std::cout << DEBUGINFO << ": Client stopped" << ::std::endl;
@@ -406,13 +1076,13 @@ namespace tcp
         return;
     }
 
-    template <class SocketType, class SocketDeleter>
-    bool Client<SocketType, SocketDeleter>::sendMsg(const ::std::string &msg)
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    bool Client<SocketType, SocketDeleter, Handler, Framing>::sendMsg(const ::std::string &msg)
     {
-        if (MESSAGE_FRAGMENTATION_ENABLED)
+        if (framing.enabled())
         {
             // Check if message doesn't contain delimiter
-            if (msg.find(DELIMITER_FOR_FRAGMENTATION) != ::std::string::npos)
+            if (msg.find(framing.delimiter()) != ::std::string::npos)
             {
 #ifdef DEVELOP
                 ::std::cerr << DEBUGINFO << ": Message contains delimiter" << ::std::endl;
@@ -422,7 +1092,7 @@ namespace tcp
             }
 
             // Check if message is too long
-            if (msg.length() > MAXIMUM_MESSAGE_LENGTH_FOR_FRAGMENTATION + APPEND_STRING_FOR_FRAGMENTATION_LENGTH)
+            if (msg.length() > framing.maxLength() + framing.appendLength())
             {
 #ifdef DEVELOP
                 ::std::cerr << DEBUGINFO << ": Message is too long" << ::std::endl;
@@ -434,7 +1104,23 @@ namespace tcp
 
         // Send the message to the server with leading and trailing characters to indicate the message length
         if (running)
-            return writeMsg(MESSAGE_FRAGMENTATION_ENABLED ? msg + APPEND_STRING_FOR_FRAGMENTATION + ::std::string{DELIMITER_FOR_FRAGMENTATION} : msg);
+        {
+            // Collect the message if a batch is open (Write the collected messages early if they get too large)
+            if (batching)
+            {
+                ::std::lock_guard<::std::mutex> lck{sendBatch_m};
+                if (batching)
+                {
+                    sendBatch += framing.enabled() ? framing.frame(msg) : msg;
+                    if (MAXIMUM_BATCH_SIZE > sendBatch.size())
+                        return true;
+                    const bool written{writeBatch(sendBatch, true)};
+                    sendBatch.clear();
+                    return written;
+                }
+            }
+            return writeMsg(framing.enabled() ? framing.frame(msg) : msg);
+        }
 
 #ifdef DEVELOP
         ::std::cerr << DEBUGINFO << ": Client not running" << ::std::endl;
@@ -443,124 +1129,912 @@ namespace tcp
         return false;
     }
 
-    template <class SocketType, class SocketDeleter>
-    void Client<SocketType, SocketDeleter>::setWorkOnMessage(::std::function<void(const ::std::string)> worker)
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    bool Client<SocketType, SocketDeleter, Handler, Framing>::beginBatch()
+    {
+        if (!running)
+        {
+#ifdef DEVELOP
+            ::std::cerr << DEBUGINFO << ": Client not running" << ::std::endl;
+#endif // DEVELOP
+
+            return false;
+        }
+
+        ::std::lock_guard<::std::mutex> lck{sendBatch_m};
+        if (!batching)
+            sendBatch.reserve(MAXIMUM_BATCH_SIZE);
+        batching = true;
+        return true;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    bool Client<SocketType, SocketDeleter, Handler, Framing>::flush()
+    {
+        ::std::lock_guard<::std::mutex> lck{sendBatch_m};
+        if (!batching)
+            return true;
+
+        // Write collected messages before closing the batch, so messages sent meanwhile wait for them
+        const bool written{sendBatch.empty() || (running && writeBatch(sendBatch, false))};
+        sendBatch.clear();
+        batching = false;
+        return written;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    ::std::future<::std::string> Client<SocketType, SocketDeleter, Handler, Framing>::request(const ::std::string &msg, const ::std::chrono::milliseconds timeout)
+    {
+        // Register the request before sending, so an early response finds it
+        ::std::future<::std::string> response;
+        const uint64_t id{pendingRequests.add(timeout, response)};
+
+        // Requests need fragmentation mode to find the response in the stream
+        if (!framing.enabled())
+        {
+            pendingRequests.fail(id, "Requests need fragmentation mode");
+            return response;
+        }
+
+        // Streamed messages are never reassembled, so the response can't be found
+        if (workOnMessageChunk)
+        {
+            pendingRequests.fail(id, "Requests can't be used with message stream workers");
+            return response;
+        }
+
+        // Look for responses in incoming messages from now on (Before sending, so an early response is found)
+        requestsSent = true;
+
+        // Send the request with its ID
+        if (!sendMsg(encodeCorrelated(id, msg)))
+            pendingRequests.fail(id, "Unable to send request");
+        return response;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Client<SocketType, SocketDeleter, Handler, Framing>::setWorkOnMessage(::std::function<void(const ::std::string)> worker)
+    {
+        handler.workOnMessage = worker;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Client<SocketType, SocketDeleter, Handler, Framing>::setInlineMessageWork(const bool enabled)
+    {
+        inlineMessageWork = enabled;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Client<SocketType, SocketDeleter, Handler, Framing>::setBusyPoll(const BusyPollPolicy &policy)
+    {
+        busyPollPolicy = policy;
+        busyPollEnabled = true;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Client<SocketType, SocketDeleter, Handler, Framing>::disableBusyPoll()
+    {
+        busyPollEnabled = false;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Client<SocketType, SocketDeleter, Handler, Framing>::setThreadAffinity(const ThreadAffinity &affinity)
+    {
+        threadAffinity = affinity;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Client<SocketType, SocketDeleter, Handler, Framing>::setSocketOptions(const SocketOptions &options)
+    {
+        socketOptions = options;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Client<SocketType, SocketDeleter, Handler, Framing>::setReceiveChunkSize(const size_t chunkSize)
+    {
+        setReceiveChunkSizeAdaptive(chunkSize, chunkSize);
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Client<SocketType, SocketDeleter, Handler, Framing>::setReceiveChunkSizeAdaptive(const size_t minChunkSize, const size_t maxChunkSize)
+    {
+        // Check chunk size bounds
+        if (0 == minChunkSize || minChunkSize > maxChunkSize)
+            throw Client_error("Invalid receive chunk size: " + ::std::to_string(minChunkSize) + " to " + ::std::to_string(maxChunkSize) + " bytes");
+
+        receiveChunkSizeMin = minChunkSize;
+        receiveChunkSizeMax = maxChunkSize;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Client<SocketType, SocketDeleter, Handler, Framing>::setMemoryResource(::std::pmr::memory_resource *resource)
+    {
+        bufferPool.setUpstream(resource);
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    BufferPoolStats Client<SocketType, SocketDeleter, Handler, Framing>::getBufferPoolStats() const
+    {
+        return bufferPool.getStats();
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Client<SocketType, SocketDeleter, Handler, Framing>::setWorkOnOversizedMessage(::std::function<void()> worker)
+    {
+        workOnOversizedMessage = worker;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    uint64_t Client<SocketType, SocketDeleter, Handler, Framing>::getOversizedMessageCount() const
+    {
+        return oversizedMessages.load(::std::memory_order_relaxed);
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Client<SocketType, SocketDeleter, Handler, Framing>::setSpillToDisk(const size_t threshold, const ::std::string &directory)
+    {
+        spillThreshold = threshold;
+        spillDirectory = directory;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Client<SocketType, SocketDeleter, Handler, Framing>::setWorkOnSpilledMessage(::std::function<void(const char *, const size_t)> worker)
+    {
+        handler.workOnSpilledMessage = worker;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Client<SocketType, SocketDeleter, Handler, Framing>::setWorkOnMessageStream(::std::function<void()> begin,
+                                                                                     ::std::function<void(const char *, const size_t)> chunk,
+                                                                                     ::std::function<void(const bool)> end)
+    {
+        workOnMessageBegin = begin;
+        workOnMessageChunk = chunk;
+        workOnMessageEnd = end;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Client<SocketType, SocketDeleter, Handler, Framing>::setWorkOnData(::std::function<void(const char *, const size_t)> worker, const size_t batchSize)
+    {
+        workOnData = worker;
+        dataBatchSize = batchSize;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Client<SocketType, SocketDeleter, Handler, Framing>::setSpliceTarget(const int fd)
+    {
+        spliceTarget = fd;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    SpliceStats Client<SocketType, SocketDeleter, Handler, Framing>::getSpliceStats() const
+    {
+        SpliceStats stats;
+        stats.splicedBytes = splicedBytes.load(::std::memory_order_relaxed);
+        stats.copiedBytes = copiedBytes.load(::std::memory_order_relaxed);
+        return stats;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    bool Client<SocketType, SocketDeleter, Handler, Framing>::pauseReading()
+    {
+        if (!running)
+            return false;
+        readPause.pause();
+        return true;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    bool Client<SocketType, SocketDeleter, Handler, Framing>::resumeReading()
     {
-        workOnMessage = worker;
+        if (!running)
+            return false;
+        readPause.resume();
+
+        // Wait for data again if attached to a shared I/O context
+        ::std::lock_guard<::std::mutex> lck{io_m};
+        if (ioRegistration)
+            attachedIoContext->rearm(ioRegistration);
+        return true;
     }
 
-    template <class SocketType, class SocketDeleter>
-    void Client<SocketType, SocketDeleter>::receive()
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    Handler &Client<SocketType, SocketDeleter, Handler, Framing>::getHandler()
     {
-        // Do receive loop until client is stopped
-        ::std::string buffer;
+        return handler;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Client<SocketType, SocketDeleter, Handler, Framing>::receive()
+    {
+        // Receive from the server until the client is stopped or the connection is lost without reconnecting
+        while (receiveConnection() && reconnect())
+            ;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    bool Client<SocketType, SocketDeleter, Handler, Framing>::receiveConnection()
+    {
+        // Pin the receive thread before its buffers are allocated, so their pages are placed on its NUMA node
+        // A spinning receive thread stays on the CPUs of the busy poll policy, otherwise it follows the incoming data if enabled
+        const bool busyPoll{busyPollEnabled};
+        const int incoming{threadAffinity.followIncomingCpu ? incomingCpu(tcpSocket) : -1};
+        if (busyPoll && !busyPollPolicy.cpus.empty())
+            pinCurrentThread(busyPollPolicy.cpus);
+        else if (0 <= incoming)
+            pinCurrentThread({incoming});
+        else
+            pinCurrentThread(threadAffinity.io);
+
+        // Read until the connection is closed
+        // The workers run on the NUMA node of the incoming data if followed
+        ::std::unique_ptr<ReceiveState> state{newReceiveState(inlineMessageWork)};
+        state->workerCpus = 0 <= incoming ? cpusOfNode(nodeOfCpu(incoming)) : threadAffinity.workers;
+        const ::std::chrono::microseconds busyPollBudget{busyPollPolicy.budget};
+        if (busyPoll)
+            enableSocketBusyPoll(tcpSocket, busyPollBudget);
         while (1)
         {
-            // Wait for incoming data from the server
-            // This method blocks until data is received
-            // An empty string is returned if the connection is crashed
-            ::std::string msg{readMsg()};
-            if (msg.empty())
+            // Don't read while reading is paused, so the kernel receive window throttles the server
+            readPause.waitWhilePaused();
+
+            // Spin for incoming data before blocking in the read (Unless data is buffered by the connection already)
+            if (busyPoll && !pendingData())
+                spinUntilReadable(tcpSocket, busyPollBudget);
+
+            if (!receiveStep(*state))
+                return endConnection(*state);
+        }
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    IoContinuation Client<SocketType, SocketDeleter, Handler, Framing>::receiveReady()
+    {
+        // Don't read while reading is paused, so the kernel receive window throttles the server (Rearmed by resumeReading)
+        if (readPause.isPaused())
+            return IoContinuation::PARK;
+
+        // Read the signaled data and all data already buffered by the connection
+        // Close the connection if it is lost or the client is stopped meanwhile (e.g. by a message worker)
+        do
+        {
+            if (!receiveStep(*ioState) || !running)
+            {
+                const bool lost{endConnection(*ioState)};
+
+                // Reconnect in a separate thread, so the worker is not blocked while waiting for the next attempt
+                ::std::thread finished{};
+                {
+                    ::std::lock_guard<::std::mutex> lck{io_m};
+                    ioRegistration = 0;
+                    if (lost && reconnectEnabled)
+                    {
+                        finished = ::std::move(recHandler);
+                        recHandler = ::std::thread{[this]()
+                                                   {
+                                                       // Attach the new connection (Client stops if this fails)
+                                                       if (reconnect() && !attachIo())
+                                                           running = false;
+                                                       return;
+                                                   }};
+                    }
+                }
+                if (finished.joinable())
+                    finished.join();
+                return IoContinuation::DONE;
+            }
+        } while (pendingData());
+        return IoContinuation::REARM;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    bool Client<SocketType, SocketDeleter, Handler, Framing>::receiveStep(ReceiveState &state)
+    {
+        // Wait for incoming data from the server
+        // This method blocks until data is received
+        // No data is read if the connection is crashed
+        // Data is forwarded to the splice target directly if set
+        const ssize_t lenMsg{state.spliceForwarder ? state.spliceForwarder->forward() : readMsg(state.receiveBuffer.data(), state.receiveBuffer.size())};
+
+        // Connection is closed (Unless only protocol data was read, e.g. a TLS session ticket)
+        if (0 >= lenMsg)
+            return readWouldBlock(lenMsg);
+
+        // The kernel leaves quick ack mode on its own, so renew it after each read
+        if (socketOptions.quickAck)
+            setIntSocketOption(tcpSocket, IPPROTO_TCP, TCP_QUICKACK, 1);
+
+        // Data is already forwarded to the splice target
+        if (state.spliceForwarder)
+            return true;
+
+        // If stream shall be fragmented and messages shall be streamed ...
+        if (framing.enabled() && workOnMessageChunk)
+        {
+            // Pass all message parts to the streaming workers directly from the receive buffer
+            const char *msg_begin{state.receiveBuffer.data()};
+            const char *const msg_end{msg_begin + lenMsg};
+            const char *delimiter_pos{static_cast<const char *>(memchr(msg_begin, framing.delimiter(), msg_end - msg_begin))};
+            while (delimiter_pos)
+            {
+                streamMessagePart(msg_begin, delimiter_pos - msg_begin, state.streamState);
+                streamMessageEnd(state.streamState, true);
+                msg_begin = delimiter_pos + 1;
+                delimiter_pos = static_cast<const char *>(memchr(msg_begin, framing.delimiter(), msg_end - msg_begin));
+            }
+            streamMessagePart(msg_begin, msg_end - msg_begin, state.streamState);
+        }
+
+        // If stream shall be fragmented ...
+        else if (framing.enabled())
+        {
+            // Get raw message parts separated by delimiter directly from the receive buffer
+            // Each complete part is appended to the message buffer without creating temporary strings
+            const char *msg_begin{state.receiveBuffer.data()};
+            const char *const msg_end{msg_begin + lenMsg};
+            const char *delimiter_pos{static_cast<const char *>(memchr(msg_begin, framing.delimiter(), msg_end - msg_begin))};
+            while (delimiter_pos)
             {
+                const char *const msg_part{msg_begin};
+                const size_t msg_part_len{static_cast<size_t>(delimiter_pos - msg_begin)};
+                msg_begin = delimiter_pos + 1;
+                delimiter_pos = static_cast<const char *>(memchr(msg_begin, framing.delimiter(), msg_end - msg_begin));
+
+                // Drop the message if it is too long (Already reported if the rest of it was skipped)
+                if (state.skipOversized || state.buffer.size() + msg_part_len > framing.maxLength())
+                {
+                    if (!state.skipOversized)
+                        reportOversizedMessage();
+                    state.skipOversized = false;
+                    state.buffer.clear();
+                    continue;
+                }
+
+                // Drop the message if it could not be stored
+                if (!appendMessagePart(state.buffer, msg_part, msg_part_len))
+                {
+                    state.buffer.clear();
+                    continue;
+                }
+
 #ifdef DEVELOP
-                ::std::cout << DEBUGINFO << ": Connection to server lost" << ::std::endl;
+                ::std::cout << DEBUGINFO << ": Received message from server: " << state.buffer.view() << ::std::endl;
 #endif // DEVELOP
 
-                // Stop the client
-                running = false;
+                // Pass a response to its waiting request directly
+                if (completeRequest(state.buffer))
+                    continue;
 
-                // Wait for all work handlers to finish
-                for (auto &it : workHandlers)
-                    it.join();
+                // Handle the message directly in the receive thread or the worker of the shared I/O context (It reads one connection at a time in order)
+                if (state.inlineDelivery)
+                {
+                    handler.message(::std::move(state.buffer));
+                    continue;
+                }
 
-                // Block the TCP socket to abort receiving process
-                // If shutdown failed, abort stop here
-                connectionDeinit();
-                if (shutdown(tcpSocket, SHUT_RDWR))
-                    return;
+                ::std::unique_ptr<RunningFlag> workRunning{new RunningFlag{true}};
+                ::std::thread work_t{[this, &workerCpus = state.workerCpus](RunningFlag *workRunning_p, MessageType buffer)
+                                     {
+                                         // Mark thread as running
+                                         Client_running_manager running_mgr{*workRunning_p};
 
-                // Close the TCP socket
-                close(tcpSocket);
+                                         // Keep the worker on its CPUs
+                                         pinCurrentThread(workerCpus);
 
-                return;
+                                         // Run code to handle the incoming message
+                                         handler.message(::std::move(buffer));
+
+                                         return;
+                                     },
+                                     workRunning.get(), ::std::move(state.buffer)};
+
+                // Remove all finished work handlers from the vector
+                size_t workHandlers_s{workHandlersRunning.size()};
+                for (size_t i{0}; i < workHandlers_s; i += 1)
+                {
+                    if (!*workHandlersRunning[i].get())
+                    {
+                        workHandlers[i].join();
+                        workHandlers.erase(workHandlers.begin() + i);
+                        workHandlersRunning.erase(workHandlersRunning.begin() + i);
+                        i -= 1;
+                        workHandlers_s -= 1;
+                    }
+                }
+
+                workHandlers.push_back(::std::move(work_t));
+                workHandlersRunning.push_back(::std::move(workRunning));
             }
 
-            // If stream shall be fragmented ...
-            if (MESSAGE_FRAGMENTATION_ENABLED)
+            // Keep the incomplete rest of the message only if it doesn't exceed the maximum length yet
+            // Otherwise skip all data until the next delimiter without storing it
+            if (!state.skipOversized)
             {
-                // Get raw message separated by delimiter
-                // If delimiter is found, the message is split into two parts
-                size_t delimiter_pos{msg.find(DELIMITER_FOR_FRAGMENTATION)};
-                while (::std::string::npos != delimiter_pos)
+                if (state.buffer.size() + (msg_end - msg_begin) > framing.maxLength())
+                {
+                    reportOversizedMessage();
+                    state.skipOversized = true;
+                    state.buffer.clear();
+                }
+                else if (!appendMessagePart(state.buffer, msg_begin, msg_end - msg_begin))
                 {
-                    ::std::string msg_part{msg.substr(0, delimiter_pos)};
-                    msg = msg.substr(delimiter_pos + 1);
-                    delimiter_pos = msg.find(DELIMITER_FOR_FRAGMENTATION);
+                    state.skipOversized = true;
+                    state.buffer.clear();
+                }
+            }
+        }
 
-                    // Check if the message is too long
-                    if (buffer.size() + msg_part.size() > MAXIMUM_MESSAGE_LENGTH_FOR_FRAGMENTATION)
-                    {
+        // If stream shall be passed to the data worker ...
+        else if (workOnData)
+        {
+            // A read not filling the receive buffer means no more data is waiting
+            const bool drained{static_cast<size_t>(lenMsg) < state.receiveBuffer.size()};
+
+            // Pass data directly from the receive buffer if nothing is collected and the read is large enough or the last one for now
+            if (state.dataBatch.empty() && (drained || static_cast<size_t>(lenMsg) >= state.batchSize))
+                workOnData(state.receiveBuffer.data(), lenMsg);
+
+            // Otherwise collect data until the batch is full or no more data is waiting
+            else
+            {
+                state.dataBatch.insert(state.dataBatch.end(), state.receiveBuffer.data(), state.receiveBuffer.data() + lenMsg);
+                if (drained || state.dataBatch.size() >= state.batchSize)
+                {
+                    workOnData(state.dataBatch.data(), state.dataBatch.size());
+                    state.dataBatch.clear();
+                }
+            }
+        }
+
+        // If stream shall be forwarded to continuous out stream ...
+        else
+        {
+            // Just forward incoming message to output stream
+            CONTINUOUS_OUTPUT_STREAM.write(state.receiveBuffer.data(), lenMsg).flush();
+        }
+
+        // Adapt receive buffer size to the last read
+        state.receiveBuffer.update(lenMsg);
+
+        return true;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    bool Client<SocketType, SocketDeleter, Handler, Framing>::endConnection(ReceiveState &state)
+    {
 #ifdef DEVELOP
-                        ::std::cerr << DEBUGINFO << ": Message from server is too long" << ::std::endl;
+        ::std::cout << DEBUGINFO << ": Connection to server lost" << ::std::endl;
 #endif // DEVELOP
 
-                        buffer.clear();
-                        continue;
-                    }
+        // Stop the client (The connection is lost if the client is not stopped already)
+        const bool lost{running.exchange(false)};
+
+        // Drop messages collected for the lost connection
+        {
+            ::std::lock_guard<::std::mutex> lck{sendBatch_m};
+            sendBatch.clear();
+        }
+
+        // Wait for all work handlers to finish
+        for (auto &it : workHandlers)
+            it.join();
+        workHandlers.clear();
+        workHandlersRunning.clear();
+
+        // Abort a message streamed at the moment
+        streamMessageEnd(state.streamState, false);
+
+        // Responses to waiting requests can't arrive anymore
+        pendingRequests.failAll("Connection to server lost");
+
+        // Pass remaining collected data
+        if (!state.dataBatch.empty())
+            workOnData(state.dataBatch.data(), state.dataBatch.size());
+
+        // Block and close the TCP socket (If not already closed by stop)
+        ::std::lock_guard<::std::mutex> lck{connection_m};
+        connectionDeinit();
+        if (0 <= tcpSocket)
+        {
+            shutdown(tcpSocket, SHUT_RDWR);
+            close(tcpSocket);
+            tcpSocket = -1;
+        }
+
+        return lost;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    typename Client<SocketType, SocketDeleter, Handler, Framing>::ReceiveState *Client<SocketType, SocketDeleter, Handler, Framing>::newReceiveState(const bool inlineDelivery)
+    {
+        ReceiveState *state{new ReceiveState{receiveChunkSizeMin, receiveChunkSizeMax, &bufferPool, dataBatchSize, inlineDelivery}};
+
+        // Forward incoming data to the splice target directly (Continuous mode on unencrypted connections only)
+        if (!framing.enabled() && 0 <= spliceTarget && spliceSupported())
+            state->spliceForwarder.reset(new SpliceForwarder{tcpSocket, spliceTarget, DEFAULT_SPLICE_CHUNK_SIZE, splicedBytes, copiedBytes});
+        return state;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    bool Client<SocketType, SocketDeleter, Handler, Framing>::attachIo()
+    {
+        // Receive state must exist before a worker can read
+        ioState.reset(newReceiveState(true));
+
+        // Don't attach if the client is stopped meanwhile (It closes the socket)
+        ::std::lock_guard<::std::mutex> lck{io_m};
+        {
+            ::std::lock_guard<::std::mutex> lckConnection{connection_m};
+            if (stopRequested)
+                return true;
+        }
+
+        // A worker of the context must not block until the rest of a message arrives (e.g. a TLS record sent in pieces),
+        // so the socket is non-blocking while attached (Writing waits for the socket instead, see waitForSocket)
+        const int flags{fcntl(tcpSocket, F_GETFL, 0)};
+        if (0 > flags || fcntl(tcpSocket, F_SETFL, flags | O_NONBLOCK))
+            return false;
+
+        ioRegistration = attachedIoContext->add(tcpSocket, [this]()
+                                                { return receiveReady(); });
+        return 0 != ioRegistration;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    bool Client<SocketType, SocketDeleter, Handler, Framing>::waitForSocket(const short events) const
+    {
+        struct pollfd socketPoll
+        {
+            tcpSocket, events, 0
+        };
+        int ready;
+        do
+            ready = poll(&socketPoll, 1, -1);
+        while (0 > ready && EINTR == errno);
+        return 0 < ready;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    bool Client<SocketType, SocketDeleter, Handler, Framing>::detachIo()
+    {
+        // Remove the connection from the shared I/O context (Waits for a worker reading from it at the moment)
+        uint64_t registration{0};
+        {
+            ::std::lock_guard<::std::mutex> lck{io_m};
+            registration = ioRegistration;
+            ioRegistration = 0;
+        }
+        if (registration)
+            return attachedIoContext->remove(registration);
+        return true;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    bool Client<SocketType, SocketDeleter, Handler, Framing>::isRunning() const
+    {
+        return running;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Client<SocketType, SocketDeleter, Handler, Framing>::reportOversizedMessage()
+    {
+#ifdef DEVELOP
+        ::std::cerr << DEBUGINFO << ": Message from server is too long" << ::std::endl;
+#endif // DEVELOP
 
-                    buffer += msg_part;
+        oversizedMessages.fetch_add(1, ::std::memory_order_relaxed);
+        if (workOnOversizedMessage)
+            workOnOversizedMessage();
+        return;
+    }
 
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    bool Client<SocketType, SocketDeleter, Handler, Framing>::appendMessagePart(MessageType &buffer, const char *part, const size_t len)
+    {
+        // Spill the message to disk if it gets too large to keep it in memory
+        if (0 < spillThreshold && !buffer.isSpilled() && buffer.size() + len > spillThreshold)
+        {
+            if (!buffer.spill(spillDirectory))
+            {
 #ifdef DEVELOP
-                    ::std::cout << DEBUGINFO << ": Received message from server: " << buffer << ::std::endl;
+                ::std::cerr << DEBUGINFO << ": Unable to spill message from server to " << spillDirectory << ": " << strerror(errno) << ::std::endl;
 #endif // DEVELOP
 
-                    ::std::unique_ptr<RunningFlag> workRunning{new RunningFlag{true}};
-                    ::std::thread work_t{[this](RunningFlag *workRunning_p, ::std::string buffer)
-                                         {
-                                             // Mark thread as running
-                                             Client_running_manager running_mgr{*workRunning_p};
+                return false;
+            }
+        }
 
-                                             // Run code to handle the incoming message
-                                             if (workOnMessage)
-                                                 workOnMessage(::std::move(buffer));
+        if (!buffer.append(part, len))
+        {
+#ifdef DEVELOP
+            ::std::cerr << DEBUGINFO << ": Unable to write message from server to spill file: " << strerror(errno) << ::std::endl;
+#endif // DEVELOP
 
-                                             return;
-                                         },
-                                         workRunning.get(), ::std::move(buffer)};
+            return false;
+        }
+        return true;
+    }
 
-                    // Remove all finished work handlers from the vector
-                    size_t workHandlers_s{workHandlersRunning.size()};
-                    for (size_t i{0}; i < workHandlers_s; i += 1)
-                    {
-                        if (!*workHandlersRunning[i].get())
-                        {
-                            workHandlers[i].join();
-                            workHandlers.erase(workHandlers.begin() + i);
-                            workHandlersRunning.erase(workHandlersRunning.begin() + i);
-                            i -= 1;
-                            workHandlers_s -= 1;
-                        }
-                    }
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Client<SocketType, SocketDeleter, Handler, Framing>::streamMessagePart(const char *part, const size_t len, MessageStreamState &state)
+    {
+        // Nothing to pass if the rest of the message is skipped
+        if (state.skipping || 0 == len)
+            return;
+
+        // Begin a new message
+        if (!state.inMessage)
+        {
+            if (workOnMessageBegin)
+                workOnMessageBegin();
+            state.inMessage = true;
+            state.length = 0;
+        }
+
+        // Drop the message if it gets too long and skip its rest until the next delimiter
+        if (state.length + len > framing.maxLength())
+        {
+            reportOversizedMessage();
+            if (workOnMessageEnd)
+                workOnMessageEnd(false);
+            state.inMessage = false;
+            state.skipping = true;
+            return;
+        }
 
-                    workHandlers.push_back(::std::move(work_t));
-                    workHandlersRunning.push_back(::std::move(workRunning));
+        workOnMessageChunk(part, len);
+        state.length += len;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Client<SocketType, SocketDeleter, Handler, Framing>::streamMessageEnd(MessageStreamState &state, const bool complete)
+    {
+        // A dropped message is already ended
+        if (state.skipping)
+        {
+            state.skipping = !complete;
+            return;
+        }
+
+        // On closed connection, only a begun message needs to be aborted
+        if (!complete && !state.inMessage)
+            return;
+
+        // Begin empty messages before ending them
+        if (!state.inMessage && workOnMessageBegin)
+            workOnMessageBegin();
+
+        if (workOnMessageEnd)
+            workOnMessageEnd(complete);
+        state.inMessage = false;
+        state.length = 0;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    bool Client<SocketType, SocketDeleter, Handler, Framing>::completeRequest(MessageType &buffer)
+    {
+        // Messages can only be responses after a request was sent
+        if (!requestsSent)
+            return false;
+
+        // Messages without correlation header are no responses
+        uint64_t id;
+        ::std::string_view payload;
+        if (!decodeCorrelated(buffer.view(), id, payload))
+            return false;
+
+        // Drop responses to requests that are not waiting anymore (e.g. timed out)
+        pendingRequests.complete(id, ::std::string{payload});
+        buffer.clear();
+        return true;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    bool Client<SocketType, SocketDeleter, Handler, Framing>::reconnect()
+    {
+        // Nothing to do if reconnecting is disabled
+        if (!reconnectEnabled)
+            return false;
+
+        reconnecting = true;
+        ReconnectBackoff backoff{reconnectPolicy};
+        const unsigned int maxAttempts{reconnectPolicy.maxAttempts};
+        unsigned int attempt{0};
+        while (0 == maxAttempts || attempt < maxAttempts)
+        {
+            attempt += 1;
+
+            // Wait before each attempt (Abort if the client is stopped meanwhile)
+            {
+                ::std::unique_lock<::std::mutex> lck{connection_m};
+                if (reconnectWait.wait_for(lck, backoff.next(), [this]()
+                                           { return stopRequested; }))
+                {
+                    reconnecting = false;
+                    return false;
                 }
-                buffer += msg;
             }
 
-            // If stream shall be forwarded to continuous out stream ...
-            else
+#ifdef DEVELOP
+            ::std::cout << DEBUGINFO << ": Reconnect attempt " << attempt << ::std::endl;
+#endif // DEVELOP
+
+            // Connect to the address of the lost connection again
+            if (CLIENT_START_OK != connectToServer({serverAddress}))
+                continue;
+
+            // Client is running again
+            readPause.reset();
+            running = true;
+            reconnecting = false;
+            if (workOnReconnect)
+                workOnReconnect(true, attempt);
+            return true;
+        }
+
+#ifdef DEVELOP
+        ::std::cerr << DEBUGINFO << ": Unable to reconnect after " << attempt << " attempts" << ::std::endl;
+#endif // DEVELOP
+
+        reconnecting = false;
+        if (workOnReconnect)
+            workOnReconnect(false, attempt);
+        return false;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    int Client<SocketType, SocketDeleter, Handler, Framing>::connectToServer(const ::std::vector<ResolvedAddress> &addresses)
+    {
+        // Try all addresses until the connection is established or the connect timeout is reached
+        const ::std::chrono::steady_clock::time_point deadline{::std::chrono::steady_clock::now() + connectTimeout};
+        int connectCode{CLIENT_ERROR_START_CONNECT};
+        for (const ResolvedAddress &address : addresses)
+        {
+            // Create the client tcp socket for the address family
+            // If socket creation fails, return with error
+            const int newSocket{socket(address.family, SOCK_STREAM, 0)};
+            if (-1 == newSocket)
             {
-                // Just forward incoming message to output stream
-                CONTINUOUS_OUTPUT_STREAM << msg << ::std::flush;
+#ifdef DEVELOP
+                ::std::cerr << DEBUGINFO << ": Error while creating client TCP socket" << ::std::endl;
+#endif // DEVELOP
+
+                return CLIENT_ERROR_START_CREATE_SOCKET;
             }
+
+            // Set the socket options before connecting, so the buffer sizes are used for the window scaling
+            // If setting fails, return with error
+            if (!setIntSocketOption(newSocket, SOL_SOCKET, SO_REUSEADDR, socketOptions.reuseAddress ? 1 : 0) || !applyConnectionSocketOptions(newSocket, socketOptions))
+            {
+#ifdef DEVELOP
+                ::std::cerr << DEBUGINFO << ": Error while setting TCP socket options" << ::std::endl;
+#endif // DEVELOP
+
+                close(newSocket);
+                return CLIENT_ERROR_START_SET_SOCKET_OPT;
+            }
+
+            // Use the new socket, so stop can abort connecting
+            // If the client is stopped already, return with error
+            {
+                ::std::lock_guard<::std::mutex> lck{connection_m};
+                if (stopRequested)
+                {
+                    close(newSocket);
+                    return CLIENT_ERROR_START_CONNECT;
+                }
+                tcpSocket = newSocket;
+            }
+
+            // Connect to the server via unencrypted TCP
+            connectCode = connectWithDeadline(address, deadline);
+            if (CLIENT_START_OK == connectCode)
+            {
+                serverAddress = address;
+                break;
+            }
+
+            // Try next address (Unless the timeout is reached)
+            {
+                ::std::lock_guard<::std::mutex> lck{connection_m};
+                close(tcpSocket);
+                tcpSocket = -1;
+            }
+            if (CLIENT_ERROR_START_CONNECT_TIMEOUT == connectCode)
+                break;
         }
+
+        // If connection fails, return with error
+        if (CLIENT_START_OK != connectCode)
+        {
+#ifdef DEVELOP
+            ::std::cerr << DEBUGINFO << ": Error while connecting to server" << ::std::endl;
+#endif // DEVELOP
+
+            return connectCode;
+        }
+
+        // Initialize the TCP connection to the server
+        // If initialization fails, close the TCP socket and return with error
+        SocketType *newClientSocket{connectionInit()};
+        ::std::lock_guard<::std::mutex> lck{connection_m};
+        clientSocket.reset(newClientSocket);
+        if (!newClientSocket)
+        {
+            shutdown(tcpSocket, SHUT_RDWR);
+            close(tcpSocket);
+            tcpSocket = -1;
+            return CLIENT_ERROR_START_CONNECT_INIT;
+        }
+        return CLIENT_START_OK;
     }
 
-    template <class SocketType, class SocketDeleter>
-    bool Client<SocketType, SocketDeleter>::isRunning() const
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    int Client<SocketType, SocketDeleter, Handler, Framing>::connectWithDeadline(const ResolvedAddress &address, const ::std::chrono::steady_clock::time_point deadline)
     {
-        return running;
+        // Connect without blocking, so the connection attempt can be aborted at the deadline
+        const int flags{fcntl(tcpSocket, F_GETFL, 0)};
+        if (0 > flags || fcntl(tcpSocket, F_SETFL, flags | O_NONBLOCK))
+            return CLIENT_ERROR_START_CONNECT;
+
+        if (connect(tcpSocket, (const struct sockaddr *)&address.address, address.length))
+        {
+            if (EINPROGRESS != errno)
+                return CLIENT_ERROR_START_CONNECT;
+
+            // Wait until the connection is established or the deadline is reached
+            struct pollfd connecting
+            {
+                tcpSocket, POLLOUT, 0
+            };
+            while (1)
+            {
+                int timeoutMs{-1};
+                if (0 < connectTimeout.count())
+                {
+                    const auto remaining{::std::chrono::ceil<::std::chrono::milliseconds>(deadline - ::std::chrono::steady_clock::now())};
+                    if (0 >= remaining.count())
+                        return CLIENT_ERROR_START_CONNECT_TIMEOUT;
+                    timeoutMs = static_cast<int>(remaining.count());
+                }
+
+                const int ready{poll(&connecting, 1, timeoutMs)};
+                if (0 < ready)
+                    break;
+                if (0 == ready)
+                    return CLIENT_ERROR_START_CONNECT_TIMEOUT;
+                if (EINTR != errno)
+                    return CLIENT_ERROR_START_CONNECT;
+            }
+
+            // Check the result of the connection attempt
+            int error{0};
+            socklen_t error_len{sizeof(error)};
+            if (getsockopt(tcpSocket, SOL_SOCKET, SO_ERROR, &error, &error_len) || error)
+                return CLIENT_ERROR_START_CONNECT;
+        }
+
+        // Switch back to blocking mode for the receive thread
+        if (fcntl(tcpSocket, F_SETFL, flags))
+            return CLIENT_ERROR_START_CONNECT;
+        return CLIENT_START_OK;
     }
 }
 
@@ -0,0 +1,348 @@
+/**
+ * @file ClientIoContext.hpp
+ * @author Nils Henrich
+ * @brief Shared event loop for many client connections.
+ * One thread waits for incoming data on all attached connections with epoll and a fixed pool of workers reads it,
+ * so the number of threads doesn't grow with the number of connections.
+ * @version 3.2.1
+ * @date 2025-02-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef CLIENTIOCONTEXT_HPP_
+#define CLIENTIOCONTEXT_HPP_
+
+#include <map>
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <cstdint>
+#include <cerrno>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include "exception.hpp"
+#include "Affinity.hpp"
+
+namespace tcp
+{
+    /**
+     * @brief What to do with a connection after its data was read
+     */
+    enum class IoContinuation : int
+    {
+        REARM, // Wait for further data
+        PARK,  // Don't wait for further data until rearm is called (e.g. reading is paused)
+        DONE,  // Connection is closed, remove it
+    };
+
+    /**
+     * @brief Event loop and worker pool shared by many client connections.
+     * A connection is passed to at most one worker at a time, so data of one connection is always read in order.
+     * A worker must not block longer than needed to read the data that is signaled, so attached sockets should be non-blocking.
+     */
+    class ClientIoContext
+    {
+    public:
+        /**
+         * @brief Constructor (Start the event loop and the workers).
+         * Throw Error if the event loop can't be created.
+         *
+         * @param workerCount   Number of worker threads (Default: 0 = Number of CPU cores)
+         * @param cpus          CPUs the event loop and the workers are pinned to (Default: Empty = Not pinned)
+         */
+        explicit ClientIoContext(const size_t workerCount = 0, const ::std::vector<int> &cpus = {}) : cpus{cpus}
+        {
+            // Create epoll instance and event to wake up the event loop on destruction
+            epollFd = epoll_create1(EPOLL_CLOEXEC);
+            wakeFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+            struct epoll_event wakeEvent
+            {
+            };
+            wakeEvent.events = EPOLLIN;
+            wakeEvent.data.u64 = 0;
+            if (0 > epollFd || 0 > wakeFd || epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeFd, &wakeEvent))
+            {
+                closeFds();
+                throw Error("Unable to create client I/O context event loop");
+            }
+
+            // Start event loop and workers
+            const size_t workers{0 < workerCount ? workerCount : (0 < ::std::thread::hardware_concurrency() ? ::std::thread::hardware_concurrency() : 1)};
+            eventLoop = ::std::thread{&ClientIoContext::runEventLoop, this};
+            for (size_t i{0}; i < workers; i += 1)
+                workerThreads.emplace_back(&ClientIoContext::runWorker, this);
+        }
+
+        /**
+         * @brief Destructor (Stop the event loop and the workers).
+         * All clients using this context must be stopped before.
+         */
+        virtual ~ClientIoContext()
+        {
+            // Stop event loop
+            {
+                ::std::lock_guard<::std::mutex> lck{connections_m};
+                stopping = true;
+            }
+            const uint64_t wake{1};
+            const ssize_t woken{write(wakeFd, &wake, sizeof(wake))};
+            (void)woken;
+            eventLoop.join();
+
+            // Stop workers
+            ready_c.notify_all();
+            for (auto &it : workerThreads)
+                it.join();
+
+            closeFds();
+        }
+
+        /**
+         * @brief Attach a connection. The reader is called by a worker each time data is available.
+         *
+         * @param fd        Socket of the connection (Non-blocking, must stay open until the connection is removed or the reader returns DONE)
+         * @param reader    Reader of the connection
+         * @return uint64_t (ID of the connection, 0 if attaching failed)
+         */
+        uint64_t add(const int fd, ::std::function<IoContinuation()> reader)
+        {
+            ::std::lock_guard<::std::mutex> lck{connections_m};
+            const uint64_t id{nextId};
+            nextId += 1;
+            Connection &connection{connections[id]};
+            connection.fd = fd;
+            connection.reader = reader;
+            if (!arm(id, fd, EPOLL_CTL_ADD))
+            {
+                connections.erase(id);
+                return 0;
+            }
+            return id;
+        }
+
+        /**
+         * @brief Wait for further data of a parked connection.
+         * If the reader of the connection is running at the moment, it is rearmed even if the reader returns PARK.
+         *
+         * @param id
+         */
+        void rearm(const uint64_t id)
+        {
+            ::std::lock_guard<::std::mutex> lck{connections_m};
+            auto it{connections.find(id)};
+            if (it == connections.end())
+                return;
+            if (it->second.running)
+                it->second.rearmPending = true;
+            else if (it->second.parked)
+            {
+                it->second.parked = false;
+                arm(id, it->second.fd, EPOLL_CTL_MOD);
+            }
+            return;
+        }
+
+        /**
+         * @brief Remove a connection (Before closing its socket).
+         * Waits until a running reader is finished. If called by the reader itself (e.g. a message worker stopping its client),
+         * the connection is erased after the reader returns instead, so the socket must not be closed before.
+         *
+         * @param id
+         * @return bool (false if called by the reader of the connection)
+         */
+        bool remove(const uint64_t id)
+        {
+            ::std::unique_lock<::std::mutex> lck{connections_m};
+            auto it{connections.find(id)};
+            if (it == connections.end())
+                return true;
+            epoll_ctl(epollFd, EPOLL_CTL_DEL, it->second.fd, nullptr);
+            it->second.removed = true;
+
+            // Called by the reader: Waiting for it would never end
+            if (it->second.running && ::std::this_thread::get_id() == it->second.readerThread)
+            {
+                it->second.removedByReader = true;
+                return false;
+            }
+
+            finished_c.wait(lck, [&it]()
+                            { return !it->second.running; });
+            connections.erase(it);
+            return true;
+        }
+
+        /**
+         * @brief Get the number of worker threads
+         *
+         * @return size_t
+         */
+        size_t getWorkerCount() const
+        {
+            return workerThreads.size();
+        }
+
+        /**
+         * @brief Get the number of attached connections
+         *
+         * @return size_t
+         */
+        size_t getConnectionCount()
+        {
+            ::std::lock_guard<::std::mutex> lck{connections_m};
+            return connections.size();
+        }
+
+    private:
+        // Attached connection
+        struct Connection
+        {
+            int fd{-1};
+            ::std::function<IoContinuation()> reader{nullptr};
+            bool running{false};
+            ::std::thread::id readerThread{};
+            bool parked{false};
+            bool rearmPending{false};
+            bool removed{false};
+            bool removedByReader{false};
+        };
+
+        /**
+         * @brief Wait for the next data of a connection (Signaled once)
+         *
+         * @param id
+         * @param fd
+         * @param operation EPOLL_CTL_ADD or EPOLL_CTL_MOD
+         * @return bool
+         */
+        bool arm(const uint64_t id, const int fd, const int operation)
+        {
+            struct epoll_event event
+            {
+            };
+            event.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+            event.data.u64 = id;
+            return 0 == epoll_ctl(epollFd, operation, fd, &event);
+        }
+
+        /**
+         * @brief Pass connections with available data to the workers until the context is destroyed
+         */
+        void runEventLoop()
+        {
+            pinCurrentThread(cpus);
+            struct epoll_event events[64];
+            while (1)
+            {
+                const int count{epoll_wait(epollFd, events, 64, -1)};
+                if (0 > count && EINTR != errno)
+                    return;
+
+                ::std::lock_guard<::std::mutex> lck{connections_m};
+                if (stopping)
+                    return;
+                for (int i{0}; i < count; i += 1)
+                {
+                    if (0 != events[i].data.u64)
+                        readyConnections.push_back(events[i].data.u64);
+                }
+                ready_c.notify_all();
+            }
+        }
+
+        /**
+         * @brief Run the readers of connections with available data until the context is destroyed
+         */
+        void runWorker()
+        {
+            pinCurrentThread(cpus);
+            ::std::unique_lock<::std::mutex> lck{connections_m};
+            while (1)
+            {
+                ready_c.wait(lck, [this]()
+                             { return stopping || !readyConnections.empty(); });
+                if (stopping)
+                    return;
+
+                // Take the next connection (Skip removed connections)
+                const uint64_t id{readyConnections.front()};
+                readyConnections.pop_front();
+                auto it{connections.find(id)};
+                if (it == connections.end() || it->second.removed)
+                    continue;
+
+                // Read without lock (The connection is not erased while its reader runs)
+                Connection &connection{it->second};
+                connection.running = true;
+                connection.readerThread = ::std::this_thread::get_id();
+                lck.unlock();
+                const IoContinuation continuation{connection.reader()};
+                lck.lock();
+                connection.running = false;
+
+                // Removed by the reader itself: Erase it now
+                if (connection.removedByReader)
+                    connections.erase(it);
+
+                // Removed meanwhile: Let remove erase it
+                else if (connection.removed)
+                    finished_c.notify_all();
+
+                // Closed by the reader: Erase it (The closed socket left epoll already)
+                else if (IoContinuation::DONE == continuation)
+                    connections.erase(it);
+
+                // Wait for further data (Unless parked and not rearmed meanwhile)
+                else if (IoContinuation::REARM == continuation || connection.rearmPending)
+                {
+                    connection.rearmPending = false;
+                    arm(id, connection.fd, EPOLL_CTL_MOD);
+                }
+                else
+                    connection.parked = true;
+            }
+        }
+
+        /**
+         * @brief Close epoll instance and wake up event
+         */
+        void closeFds()
+        {
+            if (0 <= epollFd)
+                close(epollFd);
+            if (0 <= wakeFd)
+                close(wakeFd);
+            return;
+        }
+
+        // Epoll instance and event to wake up the event loop
+        int epollFd{-1};
+        int wakeFd{-1};
+
+        // Attached connections and connections with available data waiting for a worker
+        ::std::map<uint64_t, Connection> connections{};
+        ::std::deque<uint64_t> readyConnections{};
+        uint64_t nextId{1};
+        bool stopping{false};
+        ::std::mutex connections_m{};
+        ::std::condition_variable ready_c{};
+        ::std::condition_variable finished_c{};
+
+        // Event loop and worker threads and their CPUs
+        const ::std::vector<int> cpus;
+        ::std::thread eventLoop{};
+        ::std::vector<::std::thread> workerThreads{};
+
+        // Disallow copy
+        ClientIoContext(const ClientIoContext &) = delete;
+        ClientIoContext &operator=(const ClientIoContext &) = delete;
+    };
+}
+
+#endif // CLIENTIOCONTEXT_HPP_
@@ -0,0 +1,424 @@
+/**
+ * @file ClientPool.hpp
+ * @author Nils Henrich
+ * @brief Pool of client connections to one or several servers.
+ * Messages are spread over the connections, so a slow send on one connection doesn't block all others.
+ * Lost connections are replaced in the background.
+ * @version 3.2.1
+ * @date 2025-02-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef CLIENTPOOL_HPP_
+#define CLIENTPOOL_HPP_
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <atomic>
+#include <chrono>
+
+#include "Client.hpp"
+
+// Debugging output
+#ifdef DEVELOP
+#include <iostream>
+#endif // DEVELOP
+
+namespace tcp
+{
+    /**
+     * @brief Server a pool member connects to
+     */
+    struct ClientPoolEndpoint
+    {
+        ::std::string host;
+        int port;
+    };
+
+    /**
+     * @brief How the pool chooses the member to send a message with
+     */
+    enum class ClientPoolBalancing : int
+    {
+        ROUND_ROBIN,  // Members take turns
+        LEAST_LOADED, // Member with the fewest sends queued at the moment (Members take turns on equal load)
+    };
+
+    /**
+     * @brief Pool of client connections.
+     * Each member is a client created by a factory, so all client settings (Framing, workers, certificates, ...) are made there.
+     * Members must not reconnect themselves, lost members are replaced with new ones by the pool.
+     *
+     * @param ClientType    Client class of the members (e.g. TcpClient or TlsClient)
+     */
+    template <class ClientType>
+    class ClientPool
+    {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * @param factory   Creates and configures a new member (Called on start and for each replacement)
+         * @param balancing Strategy to choose the member to send with (Default: Round robin)
+         */
+        explicit ClientPool(::std::function<::std::unique_ptr<ClientType>()> factory,
+                            const ClientPoolBalancing balancing = ClientPoolBalancing::ROUND_ROBIN) : factory{factory},
+                                                                                                      balancing{balancing} {}
+
+        /**
+         * @brief Destructor (Stop the pool)
+         */
+        virtual ~ClientPool() { stop(); }
+
+        /**
+         * @brief Start the pool with a number of members connecting to one server
+         *
+         * @param host
+         * @param port
+         * @param size  Number of members
+         * @return int (CLIENT_START_OK if at least one member is connected, otherwise the return code of the first member)
+         */
+        int start(const ::std::string &host, const int port, const size_t size)
+        {
+            return start(::std::vector<ClientPoolEndpoint>{{host, port}}, size);
+        }
+
+        /**
+         * @brief Start the pool with a number of members spread over several servers in turn.
+         * All members connect in parallel. Members failing to connect are replaced in the background like lost ones.
+         *
+         * @param endpoints Servers to connect to
+         * @param size      Number of members
+         * @return int (CLIENT_START_OK if at least one member is connected, otherwise the return code of the first member, -1 if the pool is already running or empty)
+         */
+        int start(const ::std::vector<ClientPoolEndpoint> &endpoints, const size_t size)
+        {
+            // Check if pool is already running or has nothing to connect
+            if (running || endpoints.empty() || 0 == size)
+            {
+#ifdef DEVELOP
+                ::std::cerr << DEBUGINFO << ": Client pool already running or empty" << ::std::endl;
+#endif // DEVELOP
+
+                return -1;
+            }
+
+            // Create all members and connect them in parallel
+            this->endpoints = endpoints;
+            ::std::vector<::std::future<int>> started;
+            {
+                ::std::lock_guard<::std::mutex> lck{members_m};
+                members.clear();
+                for (size_t i{0}; i < size; i += 1)
+                {
+                    members.emplace_back(new Member{});
+                    members.back()->client = factory();
+                    const ClientPoolEndpoint &endpoint{endpoints[i % endpoints.size()]};
+                    started.push_back(members.back()->client->startAsync(endpoint.host, endpoint.port));
+                }
+            }
+
+            // The pool is usable if at least one member is connected
+            int startCode{CLIENT_START_OK};
+            bool connected{false};
+            for (size_t i{0}; i < started.size(); i += 1)
+            {
+                const int code{started[i].get()};
+                if (CLIENT_START_OK == code)
+                    connected = true;
+                else if (CLIENT_START_OK == startCode)
+                    startCode = code;
+            }
+            if (!connected)
+            {
+                ::std::lock_guard<::std::mutex> lck{members_m};
+                members.clear();
+                return startCode;
+            }
+
+            // Replace lost members in the background while the pool is running
+            stopRequested = false;
+            replaced = 0;
+            running = true;
+            maintainer = ::std::thread{&ClientPool::maintain, this};
+
+            return CLIENT_START_OK;
+        }
+
+        /**
+         * @brief Stop the pool and all members
+         */
+        void stop()
+        {
+            // Stop replacing members
+            running = false;
+            {
+                ::std::lock_guard<::std::mutex> lck{members_m};
+                stopRequested = true;
+            }
+            maintain_c.notify_all();
+            if (maintainer.joinable())
+                maintainer.join();
+
+            // Stop all members (Wait for sends in progress)
+            ::std::lock_guard<::std::mutex> lck{members_m};
+            for (auto &it : members)
+            {
+                ::std::lock_guard<::std::mutex> lckSend{it->send_m};
+                it->client->stop();
+            }
+            return;
+        }
+
+        /**
+         * @brief Send a message with a member chosen by the balancing strategy.
+         * Sends on the same member are serialized, sends on different members run in parallel.
+         * If sending fails, the message is tried with the next member until each member was tried once.
+         *
+         * @param msg
+         * @return bool
+         */
+        bool sendMsg(const ::std::string &msg)
+        {
+            if (!running)
+                return false;
+
+            // Number of members to try (The pool may be restarted meanwhile)
+            const size_t first{nextMember.fetch_add(1, ::std::memory_order_relaxed)};
+            size_t attempts;
+            {
+                ::std::lock_guard<::std::mutex> lck{members_m};
+                attempts = members.size();
+            }
+
+            for (size_t attempt{0}; attempt < attempts; attempt += 1)
+            {
+                // Choose a connected member and queue the send on it
+                // The member is shared with the pool, so it outlives a restart of the pool during the send
+                ::std::shared_ptr<Member> member;
+                ::std::shared_ptr<ClientType> client;
+                {
+                    ::std::lock_guard<::std::mutex> lck{members_m};
+                    member = chooseMember(first + attempt);
+                    if (!member)
+                        return false;
+                    client = member->client;
+                    member->queued += 1;
+                }
+
+                // Send (Wait for sends queued on the member before)
+                bool sent;
+                {
+                    ::std::lock_guard<::std::mutex> lck{member->send_m};
+                    sent = client->sendMsg(msg);
+                }
+                member->queued -= 1;
+                if (sent)
+                    return true;
+            }
+
+#ifdef DEVELOP
+            ::std::cerr << DEBUGINFO << ": No pool member could send the message" << ::std::endl;
+#endif // DEVELOP
+
+            return false;
+        }
+
+        /**
+         * @brief Set the time between checks for lost members (Default: 100 milliseconds).
+         * Each check replaces all lost members.
+         *
+         * @param interval
+         */
+        void setReplaceInterval(const ::std::chrono::milliseconds interval)
+        {
+            replaceInterval = interval;
+            return;
+        }
+
+        /**
+         * @brief Get the number of sends queued on each member at the moment (Including the one in progress)
+         *
+         * @return vector<size_t>
+         */
+        ::std::vector<size_t> getQueueDepths()
+        {
+            ::std::lock_guard<::std::mutex> lck{members_m};
+            ::std::vector<size_t> depths;
+            for (auto &it : members)
+                depths.push_back(it->queued);
+            return depths;
+        }
+
+        /**
+         * @brief Get the number of members
+         *
+         * @return size_t
+         */
+        size_t getSize()
+        {
+            ::std::lock_guard<::std::mutex> lck{members_m};
+            return members.size();
+        }
+
+        /**
+         * @brief Get the number of connected members
+         *
+         * @return size_t
+         */
+        size_t getConnectedCount()
+        {
+            ::std::lock_guard<::std::mutex> lck{members_m};
+            size_t connected{0};
+            for (auto &it : members)
+            {
+                if (it->client->isRunning())
+                    connected += 1;
+            }
+            return connected;
+        }
+
+        /**
+         * @brief Get the number of members replaced since the pool was started
+         *
+         * @return size_t
+         */
+        size_t getReplacedCount() const
+        {
+            return replaced;
+        }
+
+        /**
+         * @brief Get the running flag of the pool
+         *
+         * @return true
+         * @return false
+         */
+        bool isRunning() const
+        {
+            return running;
+        }
+
+    private:
+        // Member of the pool
+        struct Member
+        {
+            ::std::shared_ptr<ClientType> client;
+            ::std::atomic<size_t> queued{0};
+            ::std::mutex send_m{};
+        };
+
+        /**
+         * @brief Choose the member to send with (members_m must be locked)
+         *
+         * @param turn  Position of the sender in the round robin
+         * @return shared_ptr<Member> (nullptr if no member is connected)
+         */
+        ::std::shared_ptr<Member> chooseMember(const size_t turn)
+        {
+            ::std::shared_ptr<Member> chosen{nullptr};
+            for (size_t i{0}; i < members.size(); i += 1)
+            {
+                const ::std::shared_ptr<Member> &member{members[(turn + i) % members.size()]};
+                if (!member->client->isRunning())
+                    continue;
+
+                // Round robin: First connected member in turn
+                if (ClientPoolBalancing::ROUND_ROBIN == balancing)
+                    return member;
+
+                // Least loaded: Member with fewest queued sends
+                if (!chosen || member->queued < chosen->queued)
+                    chosen = member;
+            }
+            return chosen;
+        }
+
+        /**
+         * @brief Replace lost members until the pool is stopped
+         */
+        void maintain()
+        {
+            while (1)
+            {
+                // Wait for the next check (Abort if the pool is stopped meanwhile)
+                {
+                    ::std::unique_lock<::std::mutex> lck{members_m};
+                    if (maintain_c.wait_for(lck, replaceInterval, [this]()
+                                            { return stopRequested; }))
+                        return;
+                }
+
+                for (size_t i{0}; i < members.size() && running; i += 1)
+                {
+                    Member &member{*members[i]};
+                    if (member.client->isRunning())
+                        continue;
+
+                    // Connect a new member without lock, so sending with other members goes on
+                    // If connecting fails, try again on the next check
+                    ::std::shared_ptr<ClientType> client{factory()};
+                    const ClientPoolEndpoint &endpoint{endpoints[i % endpoints.size()]};
+                    if (CLIENT_START_OK != client->start(endpoint.host, endpoint.port))
+                        continue;
+
+#ifdef DEVELOP
+                    ::std::cout << DEBUGINFO << ": Pool member " << i << " replaced" << ::std::endl;
+#endif // DEVELOP
+
+                    // Swap in the new member and stop the lost one after sends queued on it are finished
+                    ::std::shared_ptr<ClientType> lost;
+                    {
+                        ::std::lock_guard<::std::mutex> lck{members_m};
+                        lost = ::std::move(member.client);
+                        member.client = ::std::move(client);
+                    }
+                    {
+                        ::std::lock_guard<::std::mutex> lckSend{member.send_m};
+                        lost->stop();
+                    }
+                    replaced += 1;
+                }
+            }
+        }
+
+        // Creates new members
+        ::std::function<::std::unique_ptr<ClientType>()> factory;
+
+        // Strategy to choose the member to send with
+        const ClientPoolBalancing balancing;
+
+        // Servers to connect to and members (Member i connects to endpoint i modulo number of endpoints)
+        // Members are shared with the sends in progress
+        ::std::vector<ClientPoolEndpoint> endpoints{};
+        ::std::vector<::std::shared_ptr<Member>> members{};
+        ::std::mutex members_m{};
+
+        // Position of the next sender in the round robin
+        ::std::atomic<size_t> nextMember{0};
+
+        // Replacement of lost members in the background
+        ::std::thread maintainer{};
+        ::std::condition_variable maintain_c{};
+        ::std::chrono::milliseconds replaceInterval{100};
+        bool stopRequested{false};
+        ::std::atomic<size_t> replaced{0};
+
+        // Flag to indicate if the pool is running
+        ::std::atomic<bool> running{false};
+
+        // Disallow copy
+        ClientPool(const ClientPool &) = delete;
+        ClientPool &operator=(const ClientPool &) = delete;
+    };
+}
+
+#endif // CLIENTPOOL_HPP_
@@ -0,0 +1,297 @@
+/**
+ * @file Correlation.hpp
+ * @author Nils Henrich
+ * @brief Correlation of requests and responses in fragmentation mode.
+ * A correlated message starts with a header containing the request ID, so many requests can be in flight on one connection
+ * and responses can arrive in any order.
+ * @version 3.2.1
+ * @date 2025-02-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef CORRELATION_HPP_
+#define CORRELATION_HPP_
+
+#include <string>
+#include <string_view>
+#include <map>
+#include <future>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <cstdint>
+#include "exception.hpp"
+
+namespace tcp
+{
+    // Characters enclosing the request ID at the beginning of a correlated message (Must not be used as delimiter)
+    constexpr char CORRELATION_HEADER_BEGIN{'\x01'};
+    constexpr char CORRELATION_HEADER_END{'\x02'};
+
+    /**
+     * @brief Error a request fails with (Timeout, connection lost or message not sent)
+     */
+    class Request_error : public Error
+    {
+    public:
+        Request_error(::std::string msg = "request failed") : Error{msg} {}
+    };
+
+    /**
+     * @brief Add the correlation header to a message
+     *
+     * @param id    Request ID
+     * @param msg
+     * @return string
+     */
+    inline ::std::string encodeCorrelated(const uint64_t id, const ::std::string &msg)
+    {
+        ::std::string correlated;
+        correlated.reserve(msg.size() + 22);
+        correlated += CORRELATION_HEADER_BEGIN;
+        correlated += ::std::to_string(id);
+        correlated += CORRELATION_HEADER_END;
+        correlated += msg;
+        return correlated;
+    }
+
+    /**
+     * @brief Split a correlated message into request ID and payload
+     *
+     * @param msg
+     * @param id        Request ID
+     * @param payload   Message without header (Points into msg)
+     * @return bool (false if the message has no valid correlation header)
+     */
+    inline bool decodeCorrelated(const ::std::string_view msg, uint64_t &id, ::std::string_view &payload)
+    {
+        if (msg.empty() || CORRELATION_HEADER_BEGIN != msg[0])
+            return false;
+
+        // Read the decimal ID up to the end of the header (At most 20 digits)
+        uint64_t value{0};
+        size_t pos{1};
+        for (; pos < msg.size() && pos <= 20 && '0' <= msg[pos] && '9' >= msg[pos]; pos += 1)
+            value = value * 10 + static_cast<uint64_t>(msg[pos] - '0');
+        if (1 == pos || pos >= msg.size() || CORRELATION_HEADER_END != msg[pos])
+            return false;
+
+        id = value;
+        payload = msg.substr(pos + 1);
+        return true;
+    }
+
+    /**
+     * @brief Requests waiting for their responses.
+     * Each request gets a unique ID and a future for its response. Requests without response in time fail with Request_error.
+     * The deadlines are watched by one thread, that is started with the first request.
+     */
+    class PendingRequests
+    {
+    public:
+        PendingRequests() {}
+
+        /**
+         * @brief Destructor (Fail all waiting requests and stop watching deadlines)
+         */
+        virtual ~PendingRequests()
+        {
+            {
+                ::std::lock_guard<::std::mutex> lck{requests_m};
+                stopping = true;
+            }
+            deadline_c.notify_all();
+            if (deadlineWatcher.joinable())
+                deadlineWatcher.join();
+            failAll("Request aborted");
+        }
+
+        /**
+         * @brief Add a new request
+         *
+         * @param timeout   Maximum time to wait for the response
+         * @param response  Future for the response
+         * @return uint64_t (Request ID)
+         */
+        uint64_t add(const ::std::chrono::milliseconds timeout, ::std::future<::std::string> &response)
+        {
+            ::std::lock_guard<::std::mutex> lck{requests_m};
+            const uint64_t id{nextId};
+            nextId += 1;
+            const ::std::chrono::steady_clock::time_point deadline{::std::chrono::steady_clock::now() + timeout};
+            Request &request{requests[id]};
+            request.deadline = deadlines.emplace(deadline, id);
+            response = request.response.get_future();
+
+            // Watch the deadline (Start watching with the first request, wake up if it is the earliest one)
+            if (!deadlineWatcher.joinable())
+                deadlineWatcher = ::std::thread{&PendingRequests::watchDeadlines, this};
+            else if (deadlines.begin()->second == id)
+                deadline_c.notify_all();
+            return id;
+        }
+
+        /**
+         * @brief Pass the response to a waiting request
+         *
+         * @param id
+         * @param response
+         * @return bool (false if no request with this ID is waiting, e.g. it timed out already)
+         */
+        bool complete(const uint64_t id, ::std::string response)
+        {
+            ::std::promise<::std::string> promise;
+            {
+                ::std::lock_guard<::std::mutex> lck{requests_m};
+                if (!take(id, promise))
+                    return false;
+            }
+            promise.set_value(::std::move(response));
+            return true;
+        }
+
+        /**
+         * @brief Let a waiting request fail
+         *
+         * @param id
+         * @param reason
+         * @return bool (false if no request with this ID is waiting)
+         */
+        bool fail(const uint64_t id, const ::std::string &reason)
+        {
+            ::std::promise<::std::string> promise;
+            {
+                ::std::lock_guard<::std::mutex> lck{requests_m};
+                if (!take(id, promise))
+                    return false;
+            }
+            setError(promise, reason);
+            return true;
+        }
+
+        /**
+         * @brief Let all waiting requests fail (e.g. the connection is lost)
+         *
+         * @param reason
+         */
+        void failAll(const ::std::string &reason)
+        {
+            ::std::map<uint64_t, Request> failed;
+            {
+                ::std::lock_guard<::std::mutex> lck{requests_m};
+                failed.swap(requests);
+                deadlines.clear();
+            }
+            for (auto &it : failed)
+                setError(it.second.response, reason);
+            return;
+        }
+
+        /**
+         * @brief Get the number of waiting requests
+         *
+         * @return size_t
+         */
+        size_t size()
+        {
+            ::std::lock_guard<::std::mutex> lck{requests_m};
+            return requests.size();
+        }
+
+    private:
+        // Waiting request
+        struct Request
+        {
+            ::std::promise<::std::string> response{};
+            ::std::multimap<::std::chrono::steady_clock::time_point, uint64_t>::iterator deadline{};
+        };
+
+        /**
+         * @brief Remove a waiting request (requests_m must be locked)
+         *
+         * @param id
+         * @param promise   Promise of the removed request
+         * @return bool (false if no request with this ID is waiting)
+         */
+        bool take(const uint64_t id, ::std::promise<::std::string> &promise)
+        {
+            auto it{requests.find(id)};
+            if (it == requests.end())
+                return false;
+            promise = ::std::move(it->second.response);
+            deadlines.erase(it->second.deadline);
+            requests.erase(it);
+            return true;
+        }
+
+        /**
+         * @brief Let a request fail with Request_error
+         *
+         * @param promise
+         * @param reason
+         */
+        static void setError(::std::promise<::std::string> &promise, const ::std::string &reason)
+        {
+            try
+            {
+                throw Request_error{reason};
+            }
+            catch (...)
+            {
+                promise.set_exception(::std::current_exception());
+            }
+            return;
+        }
+
+        /**
+         * @brief Let requests fail when their deadline is reached until destruction
+         */
+        void watchDeadlines()
+        {
+            ::std::unique_lock<::std::mutex> lck{requests_m};
+            while (!stopping)
+            {
+                // Wait for the earliest deadline (Or the next request if none is waiting)
+                if (deadlines.empty())
+                {
+                    deadline_c.wait(lck);
+                    continue;
+                }
+                const ::std::chrono::steady_clock::time_point earliest{deadlines.begin()->first};
+                if (::std::chrono::steady_clock::now() < earliest)
+                {
+                    deadline_c.wait_until(lck, earliest);
+                    continue;
+                }
+
+                // Let the expired request fail without lock
+                ::std::promise<::std::string> promise;
+                take(deadlines.begin()->second, promise);
+                lck.unlock();
+                setError(promise, "Request timed out");
+                lck.lock();
+            }
+            return;
+        }
+
+        // Waiting requests by ID and their deadlines
+        ::std::map<uint64_t, Request> requests{};
+        ::std::multimap<::std::chrono::steady_clock::time_point, uint64_t> deadlines{};
+        uint64_t nextId{1};
+        ::std::mutex requests_m{};
+
+        // Thread watching the deadlines
+        ::std::thread deadlineWatcher{};
+        ::std::condition_variable deadline_c{};
+        bool stopping{false};
+
+        // Disallow copy
+        PendingRequests(const PendingRequests &) = delete;
+        PendingRequests &operator=(const PendingRequests &) = delete;
+    };
+}
+
+#endif // CORRELATION_HPP_
@@ -0,0 +1,130 @@
+/**
+ * @file Framing.hpp
+ * @author Nils Henrich
+ * @brief Framing policies defining how messages are separated on the network stream.
+ * A framing policy is passed as template parameter to the Server and Client classes.
+ * Compile-time policies let the compiler fold all framing checks and drop the unused mode completely.
+ * @version 3.2.1
+ * @date 2025-02-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef FRAMING_HPP_
+#define FRAMING_HPP_
+
+#include <string>
+#include <limits>
+#include <cstddef>
+
+namespace tcp
+{
+    /**
+     * @brief Framing policy configured at runtime (Default).
+     * Continuous mode or fragmentation with any delimiter, append string and maximum message length.
+     */
+    class RuntimeFraming
+    {
+    public:
+        /**
+         * @brief Constructor for continuous stream forwarding
+         */
+        RuntimeFraming() : DELIMITER_FOR_FRAGMENTATION{0},
+                           APPEND_STRING_FOR_FRAGMENTATION{},
+                           MAXIMUM_MESSAGE_LENGTH_FOR_FRAGMENTATION{0},
+                           MESSAGE_FRAGMENTATION_ENABLED{false} {}
+
+        /**
+         * @brief Constructor for fragmented messages
+         *
+         * @param delimiter     Character to split messages on
+         * @param messageAppend String to append to the end of each fragmented message (before the delimiter)
+         * @param messageMaxLen Maximum message length (actual message + length of append string)
+         */
+        RuntimeFraming(char delimiter, const ::std::string &messageAppend, size_t messageMaxLen) : DELIMITER_FOR_FRAGMENTATION{delimiter},
+                                                                                                   APPEND_STRING_FOR_FRAGMENTATION{messageAppend},
+                                                                                                   MAXIMUM_MESSAGE_LENGTH_FOR_FRAGMENTATION{messageMaxLen},
+                                                                                                   MESSAGE_FRAGMENTATION_ENABLED{true} {} // TODO: Add check if messageAppend is too long (more than messageMaxLen bytes)
+
+        // Flag if messages shall be fragmented
+        bool enabled() const { return MESSAGE_FRAGMENTATION_ENABLED; }
+
+        // Delimiter for the message framing (incoming and outgoing)
+        char delimiter() const { return DELIMITER_FOR_FRAGMENTATION; }
+
+        // Length of the string appended to each outgoing message
+        size_t appendLength() const { return APPEND_STRING_FOR_FRAGMENTATION.size(); }
+
+        // Maximum message length (incoming and outgoing)
+        size_t maxLength() const { return MAXIMUM_MESSAGE_LENGTH_FOR_FRAGMENTATION; }
+
+        /**
+         * @brief Frame an outgoing message (Add append string and delimiter)
+         *
+         * @param msg
+         * @return string
+         */
+        ::std::string frame(const ::std::string &msg) const
+        {
+            return msg + APPEND_STRING_FOR_FRAGMENTATION + DELIMITER_FOR_FRAGMENTATION;
+        }
+
+    private:
+        // Delimiter for the message framing (incoming and outgoing)
+        char DELIMITER_FOR_FRAGMENTATION;
+
+        // Append this string to the end of each outgoing fragmented message
+        ::std::string APPEND_STRING_FOR_FRAGMENTATION;
+
+        // Maximum message length (incoming and outgoing)
+        size_t MAXIMUM_MESSAGE_LENGTH_FOR_FRAGMENTATION;
+
+        // Flag if messages shall be fragmented
+        bool MESSAGE_FRAGMENTATION_ENABLED;
+    };
+
+    /**
+     * @brief Framing policy for fragmented messages with fixed delimiter and no append string.
+     * All framing checks are constant-folded by the compiler.
+     *
+     * @param Delimiter     Character to split messages on
+     * @param MaxLength     Maximum message length (default is 2⁶⁴ - 2)
+     */
+    template <char Delimiter, size_t MaxLength = ::std::numeric_limits<size_t>::max() - 1>
+    class DelimiterFraming
+    {
+    public:
+        static constexpr bool enabled() { return true; }
+        static constexpr char delimiter() { return Delimiter; }
+        static constexpr size_t appendLength() { return 0; }
+        static constexpr size_t maxLength() { return MaxLength; }
+
+        /**
+         * @brief Frame an outgoing message (Add delimiter)
+         *
+         * @param msg
+         * @return string
+         */
+        static ::std::string frame(const ::std::string &msg)
+        {
+            return msg + Delimiter;
+        }
+    };
+
+    /**
+     * @brief Framing policy for continuous stream forwarding only.
+     * The fragmentation code path is removed completely by the compiler.
+     */
+    class ContinuousFraming
+    {
+    public:
+        static constexpr bool enabled() { return false; }
+        static constexpr char delimiter() { return 0; }
+        static constexpr size_t appendLength() { return 0; }
+        static constexpr size_t maxLength() { return 0; }
+        static ::std::string frame(const ::std::string &msg) { return msg; }
+    };
+}
+
+#endif // FRAMING_HPP_
@@ -0,0 +1,412 @@
+/**
+ * @file Message.hpp
+ * @author Nils Henrich
+ * @brief Message type used on the receive path in fragmentation mode.
+ * Messages up to an inline capacity are stored in the object itself, so small messages need no heap allocation
+ * while being reassembled, passed to the work thread and handed to the handler policy.
+ * Huge messages can be spilled to a temporary file, which is mapped read-only when the content is accessed.
+ * @version 3.2.1
+ * @date 2025-02-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef MESSAGE_HPP_
+#define MESSAGE_HPP_
+
+#include <string>
+#include <string_view>
+#include <cstring>
+#include <cstdlib>
+#include <cstddef>
+#include <cerrno>
+#include <type_traits>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "exception.hpp"
+
+namespace tcp
+{
+    // Default inline capacity of a received message
+    constexpr size_t DEFAULT_MESSAGE_INLINE_CAPACITY{128};
+
+    /**
+     * @brief Received message with inline storage for small messages.
+     * Larger messages are moved to a string on the heap, which can be taken over without copying (see str()).
+     * A spilled message (see spill()) is written to an unlinked temporary file and mapped read-only on access,
+     * so its pages are file-backed and can be reclaimed by the kernel under memory pressure.
+     * Moving a message leaves the source empty.
+     *
+     * @param InlineCapacity    Maximum message size stored without heap allocation
+     */
+    template <size_t InlineCapacity>
+    class BasicMessage
+    {
+    public:
+        BasicMessage() {}
+
+        /**
+         * @brief Destructor (Close spill file and remove its mapping)
+         */
+        ~BasicMessage()
+        {
+            releaseSpill();
+        }
+
+        /**
+         * @brief Copy constructor (A spilled message is copied into memory).
+         * Throw Error if a spilled message can't be mapped.
+         *
+         * @param other
+         */
+        BasicMessage(const BasicMessage &other)
+        {
+            copyFrom(other);
+        }
+
+        /**
+         * @brief Move constructor (Source is empty afterwards)
+         *
+         * @param other
+         */
+        BasicMessage(BasicMessage &&other) noexcept
+        {
+            moveFrom(other);
+        }
+
+        BasicMessage &operator=(const BasicMessage &other)
+        {
+            if (this != &other)
+            {
+                clear();
+                copyFrom(other);
+            }
+            return *this;
+        }
+
+        BasicMessage &operator=(BasicMessage &&other) noexcept
+        {
+            if (this != &other)
+            {
+                releaseSpill();
+                moveFrom(other);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Append data to the message
+         *
+         * @param data
+         * @param len
+         * @return bool (False if writing to the spill file failed)
+         */
+        bool append(const char *data, size_t len)
+        {
+            // Store inline as long as the data fits
+            if (!onHeap && !isSpilled() && length + len <= InlineCapacity)
+            {
+                memcpy(inlineStorage + length, data, len);
+                length += len;
+                return true;
+            }
+
+            // Spilled message: Write to the spill file
+            if (isSpilled())
+                return writeSpill(data, len);
+
+            // Move to heap storage (Reserve some space ahead for further parts)
+            if (!onHeap)
+            {
+                heapStorage.reserve(length + len > 2 * InlineCapacity ? length + len : 2 * InlineCapacity);
+                heapStorage.assign(inlineStorage, length);
+                onHeap = true;
+            }
+
+            heapStorage.append(data, len);
+            length = heapStorage.size();
+            return true;
+        }
+
+        /**
+         * @brief Move the message content to an unlinked temporary file in the given directory.
+         * All data appended afterwards is written to this file.
+         *
+         * @param directory
+         * @return bool (False if the file could not be created or written, the message stays in memory then)
+         */
+        bool spill(const ::std::string &directory)
+        {
+            if (isSpilled())
+                return true;
+
+            // Create temporary file and unlink it immediately, so it is removed as soon as it is closed
+            ::std::string path{directory + "/tcp_message_XXXXXX"};
+            const int fd{mkstemp(&path[0])};
+            if (0 > fd)
+                return false;
+            unlink(path.c_str());
+
+            // Write current content to the file
+            spillFd = fd;
+            const size_t lenBefore{length};
+            length = 0;
+            if (!writeSpill(onHeap ? heapStorage.data() : inlineStorage, lenBefore))
+            {
+                releaseSpill();
+                length = lenBefore;
+                return false;
+            }
+
+            // Release heap storage
+            ::std::string{}.swap(heapStorage);
+            onHeap = false;
+            return true;
+        }
+
+        /**
+         * @brief Clear the message (Heap storage is kept for reuse, spill file is closed)
+         */
+        void clear()
+        {
+            releaseSpill();
+            heapStorage.clear();
+            length = 0;
+            return;
+        }
+
+        /**
+         * @brief Get the message content.
+         * A spilled message is mapped read-only on first access (nullptr if mapping fails).
+         *
+         * @return const char*
+         */
+        const char *data() const
+        {
+            if (isSpilled())
+                return mapSpill();
+            return onHeap ? heapStorage.data() : inlineStorage;
+        }
+
+        size_t size() const { return length; }
+        bool empty() const { return 0 == length; }
+
+        /**
+         * @brief Check if the message is stored inline (No heap allocation)
+         *
+         * @return bool
+         */
+        bool isInline() const { return !onHeap && !isSpilled(); }
+
+        /**
+         * @brief Check if the message is spilled to a temporary file
+         *
+         * @return bool
+         */
+        bool isSpilled() const { return 0 <= spillFd; }
+
+        /**
+         * @brief Get a view on the message content (Valid as long as the message is not changed, empty if mapping a spilled message fails)
+         *
+         * @return string_view
+         */
+        ::std::string_view view() const
+        {
+            const char *content{data()};
+            return content ? ::std::string_view{content, length} : ::std::string_view{};
+        }
+
+        /**
+         * @brief Copy the message content into a string
+         *
+         * @return string
+         */
+        ::std::string str() const & { return ::std::string{view()}; }
+
+        /**
+         * @brief Get the message content as string, taking over the heap storage without copying (Message is empty afterwards)
+         *
+         * @return string
+         */
+        ::std::string str() &&
+        {
+            if (!onHeap)
+            {
+                ::std::string msg{view()};
+                clear();
+                return msg;
+            }
+
+            ::std::string msg{::std::move(heapStorage)};
+            heapStorage.clear();
+            onHeap = false;
+            length = 0;
+            return msg;
+        }
+
+        /**
+         * @brief Implicit conversion to string, so handler policies taking a string keep working
+         *
+         * @return string
+         */
+        operator ::std::string() const & { return str(); }
+        operator ::std::string() && { return ::std::move(*this).str(); }
+
+    private:
+        /**
+         * @brief Append the content of another message (This message must be empty).
+         * Throw Error if the other message is spilled and can't be mapped.
+         *
+         * @param other
+         */
+        void copyFrom(const BasicMessage &other)
+        {
+            const char *content{other.data()};
+            if (!content && 0 < other.size())
+                throw Error("Unable to copy spilled message: Mapping its file failed: " + ::std::string{strerror(errno)});
+            append(content, other.size());
+            return;
+        }
+
+        /**
+         * @brief Take the content of another message and leave it empty
+         *
+         * @param other
+         */
+        void moveFrom(BasicMessage &other) noexcept
+        {
+            if (other.onHeap)
+                heapStorage = ::std::move(other.heapStorage);
+            else
+            {
+                heapStorage.clear();
+                if (!other.isSpilled())
+                    memcpy(inlineStorage, other.inlineStorage, other.length);
+            }
+            onHeap = other.onHeap;
+            length = other.length;
+            spillFd = other.spillFd;
+            spillMap = other.spillMap;
+            spillMapLength = other.spillMapLength;
+
+            other.heapStorage.clear();
+            other.onHeap = false;
+            other.length = 0;
+            other.spillFd = -1;
+            other.spillMap = nullptr;
+            other.spillMapLength = 0;
+            return;
+        }
+
+        /**
+         * @brief Write data to the end of the spill file
+         *
+         * @param data
+         * @param len
+         * @return bool
+         */
+        bool writeSpill(const char *data, size_t len)
+        {
+            // An existing mapping doesn't cover the new data
+            unmapSpill();
+
+            while (0 < len)
+            {
+                const ssize_t lenWritten{write(spillFd, data, len)};
+                if (0 > lenWritten)
+                {
+                    if (EINTR == errno)
+                        continue;
+                    return false;
+                }
+                data += lenWritten;
+                len -= lenWritten;
+                length += lenWritten;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Map the spill file read-only (If not mapped yet)
+         *
+         * @return const char*
+         */
+        const char *mapSpill() const
+        {
+            // Nothing to map for an empty file
+            if (spillMap || 0 == length)
+                return spillMap ? spillMap : inlineStorage;
+
+            void *map{mmap(nullptr, length, PROT_READ, MAP_SHARED, spillFd, 0)};
+            if (MAP_FAILED == map)
+                return nullptr;
+            spillMap = static_cast<const char *>(map);
+            spillMapLength = length;
+            return spillMap;
+        }
+
+        /**
+         * @brief Remove the mapping of the spill file
+         */
+        void unmapSpill()
+        {
+            if (spillMap)
+                munmap(const_cast<char *>(spillMap), spillMapLength);
+            spillMap = nullptr;
+            spillMapLength = 0;
+            return;
+        }
+
+        /**
+         * @brief Close the spill file and remove its mapping
+         */
+        void releaseSpill()
+        {
+            unmapSpill();
+            if (isSpilled())
+            {
+                close(spillFd);
+                length = 0;
+            }
+            spillFd = -1;
+            return;
+        }
+
+        // Inline and heap storage
+        char inlineStorage[InlineCapacity];
+        ::std::string heapStorage{};
+        bool onHeap{false};
+
+        // Spill file and its read-only mapping (Created on first access)
+        int spillFd{-1};
+        mutable const char *spillMap{nullptr};
+        mutable size_t spillMapLength{0};
+
+        // Message length
+        size_t length{0};
+    };
+
+    // Message type with the default inline capacity
+    using Message = BasicMessage<DEFAULT_MESSAGE_INLINE_CAPACITY>;
+
+    /**
+     * @brief Message type received by a handler policy.
+     * A handler policy can choose its own inline capacity by defining a member type MessageType (e.g. using MessageType = BasicMessage<64>).
+     * Otherwise Message is used.
+     *
+     * @param Handler
+     */
+    template <class Handler, class = void>
+    struct HandlerMessageType
+    {
+        using type = Message;
+    };
+    template <class Handler>
+    struct HandlerMessageType<Handler, ::std::void_t<typename Handler::MessageType>>
+    {
+        using type = typename Handler::MessageType;
+    };
+}
+
+#endif // MESSAGE_HPP_
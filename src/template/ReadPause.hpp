@@ -0,0 +1,120 @@
+/**
+ * @file ReadPause.hpp
+ * @author Nils Henrich
+ * @brief Flow control for the receive thread of a connection.
+ * While reading is paused, the receive thread doesn't read from the socket, so the kernel receive buffer fills up
+ * and the TCP receive window throttles the peer instead of data being buffered in the application.
+ * @version 3.2.1
+ * @date 2025-02-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef READPAUSE_HPP_
+#define READPAUSE_HPP_
+
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+namespace tcp
+{
+    /**
+     * @brief Pause state of reading on one connection.
+     * The receive thread calls waitWhilePaused() before each read, any thread can pause and resume.
+     * Once closed (connection shut down), the receive thread is never blocked anymore.
+     */
+    class ReadPause
+    {
+    public:
+        ReadPause() {}
+        virtual ~ReadPause() {}
+
+        /**
+         * @brief Pause reading (Takes effect before the next read)
+         */
+        void pause()
+        {
+            ::std::lock_guard<::std::mutex> lck{pause_m};
+            if (!closed)
+                paused = true;
+            return;
+        }
+
+        /**
+         * @brief Resume reading
+         */
+        void resume()
+        {
+            {
+                ::std::lock_guard<::std::mutex> lck{pause_m};
+                paused = false;
+            }
+            resumed.notify_all();
+            return;
+        }
+
+        /**
+         * @brief Resume reading and ignore all further pauses (Used when the connection is shut down)
+         */
+        void close()
+        {
+            {
+                ::std::lock_guard<::std::mutex> lck{pause_m};
+                closed = true;
+                paused = false;
+            }
+            resumed.notify_all();
+            return;
+        }
+
+        /**
+         * @brief Reset to not paused and not closed (Used when a new connection is established)
+         */
+        void reset()
+        {
+            ::std::lock_guard<::std::mutex> lck{pause_m};
+            closed = false;
+            paused = false;
+            return;
+        }
+
+        /**
+         * @brief Check if reading is paused
+         *
+         * @return bool
+         */
+        bool isPaused() const
+        {
+            return paused.load(::std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Block while reading is paused (Returns immediately without locking if not paused)
+         */
+        void waitWhilePaused()
+        {
+            if (!paused.load(::std::memory_order_acquire))
+                return;
+
+            ::std::unique_lock<::std::mutex> lck{pause_m};
+            resumed.wait(lck, [this]()
+                         { return !paused.load(::std::memory_order_relaxed); });
+            return;
+        }
+
+    private:
+        // Pause and close flags (Changed with pause_m locked, paused is read without lock on the fast path)
+        ::std::atomic_bool paused{false};
+        bool closed{false};
+        ::std::mutex pause_m;
+        ::std::condition_variable resumed;
+
+        // Disallow copy
+        ReadPause(const ReadPause &) = delete;
+        ReadPause &operator=(const ReadPause &) = delete;
+    };
+}
+
+#endif // READPAUSE_HPP_
@@ -0,0 +1,141 @@
+/**
+ * @file ReceiveBuffer.hpp
+ * @author Nils Henrich
+ * @brief Buffer reused for all reads of one connection.
+ * The buffer size is either fixed or adapts to the observed read sizes within configured bounds.
+ * @version 3.2.1
+ * @date 2025-02-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef RECEIVEBUFFER_HPP_
+#define RECEIVEBUFFER_HPP_
+
+#include <memory_resource>
+#include <cstddef>
+
+namespace tcp
+{
+    // Default size of a receive chunk (Maximum size of a TLS record)
+    constexpr size_t DEFAULT_RECEIVE_CHUNK_SIZE{16384};
+
+    /**
+     * @brief Receive buffer reused for all reads of one connection (Not zeroed, only the read bytes are used).
+     * If minimum and maximum size are equal, the buffer has a fixed size.
+     * Otherwise it starts with the minimum size, doubles when a read fills it completely
+     * and halves when several reads in a row used less than a quarter of it.
+     */
+    class ReceiveBuffer
+    {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * @param minSize   Minimum buffer size (Initial size)
+         * @param maxSize   Maximum buffer size
+         * @param resource  Memory resource to allocate the buffer from
+         */
+        ReceiveBuffer(size_t minSize, size_t maxSize, ::std::pmr::memory_resource *resource) : MINIMUM_SIZE{minSize},
+                                                                                               MAXIMUM_SIZE{maxSize},
+                                                                                               resource{resource},
+                                                                                               currentSize{minSize},
+                                                                                               buffer{static_cast<char *>(resource->allocate(minSize))} {}
+
+        /**
+         * @brief Destructor (Return buffer to the memory resource)
+         */
+        virtual ~ReceiveBuffer()
+        {
+            resource->deallocate(buffer, currentSize);
+        }
+
+        /**
+         * @brief Get the buffer to read into
+         *
+         * @return char*
+         */
+        char *data() const { return buffer; }
+
+        /**
+         * @brief Get the current buffer size
+         *
+         * @return size_t
+         */
+        size_t size() const { return currentSize; }
+
+        /**
+         * @brief Adapt the buffer size to the number of bytes of the last read.
+         * Must only be called after the read data is consumed, because the buffer content is not preserved on resizing.
+         *
+         * @param lenRead
+         */
+        void update(size_t lenRead)
+        {
+            // Fixed size: Nothing to do
+            if (MINIMUM_SIZE == MAXIMUM_SIZE)
+                return;
+
+            // Buffer was filled completely: More data is likely waiting, so grow
+            if (lenRead == currentSize && currentSize < MAXIMUM_SIZE)
+            {
+                smallReads = 0;
+                resize(currentSize > MAXIMUM_SIZE / 2 ? MAXIMUM_SIZE : currentSize * 2);
+                return;
+            }
+
+            // Less than a quarter used: Shrink if this happens several times in a row
+            if (lenRead < currentSize / 4 && currentSize > MINIMUM_SIZE)
+            {
+                smallReads += 1;
+                if (SHRINK_AFTER_SMALL_READS <= smallReads)
+                {
+                    smallReads = 0;
+                    resize(currentSize / 2 < MINIMUM_SIZE ? MINIMUM_SIZE : currentSize / 2);
+                }
+                return;
+            }
+
+            smallReads = 0;
+            return;
+        }
+
+    private:
+        /**
+         * @brief Replace the buffer by a new one with the given size
+         *
+         * @param newSize
+         */
+        void resize(size_t newSize)
+        {
+            resource->deallocate(buffer, currentSize);
+            buffer = static_cast<char *>(resource->allocate(newSize));
+            currentSize = newSize;
+            return;
+        }
+
+        // Size bounds of the buffer
+        const size_t MINIMUM_SIZE;
+        const size_t MAXIMUM_SIZE;
+
+        // Memory resource the buffer is allocated from
+        ::std::pmr::memory_resource *const resource;
+
+        // Number of small reads in a row after which the buffer is shrunk
+        static constexpr size_t SHRINK_AFTER_SMALL_READS{16};
+
+        // Current buffer size and number of small reads in a row
+        size_t currentSize;
+        size_t smallReads{0};
+
+        // Buffer memory
+        char *buffer;
+
+        // Disallow copy
+        ReceiveBuffer(const ReceiveBuffer &) = delete;
+        ReceiveBuffer &operator=(const ReceiveBuffer &) = delete;
+    };
+}
+
+#endif // RECEIVEBUFFER_HPP_
@@ -0,0 +1,84 @@
+/**
+ * @file Reconnect.hpp
+ * @author Nils Henrich
+ * @brief Policy for reconnecting a client after the connection to the server is lost.
+ * The delay between attempts grows exponentially and is randomized,
+ * so many clients losing the connection at the same time don't reconnect at the same time.
+ * @version 3.2.1
+ * @date 2025-02-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef RECONNECT_HPP_
+#define RECONNECT_HPP_
+
+#include <chrono>
+#include <random>
+
+namespace tcp
+{
+    /**
+     * @brief Configuration of automatic reconnects
+     */
+    struct ReconnectPolicy
+    {
+        unsigned int maxAttempts{0};                   // Maximum number of attempts per connection loss (0 = Unlimited)
+        ::std::chrono::milliseconds initialDelay{100}; // Delay before the first attempt
+        ::std::chrono::milliseconds maxDelay{30000};   // Upper bound of the delay
+        double multiplier{2.0};                        // Factor the delay grows by after each failed attempt
+        double jitter{0.5};                            // Fraction of each delay that is randomized (0 = Fixed delays, 1 = Anything between 0 and the delay)
+    };
+
+    /**
+     * @brief Delays between reconnect attempts following a reconnect policy (Exponential backoff with jitter)
+     */
+    class ReconnectBackoff
+    {
+    public:
+        /**
+         * @brief Constructor (Seed the random generator separately for each instance)
+         *
+         * @param policy
+         */
+        explicit ReconnectBackoff(const ReconnectPolicy &policy) : POLICY{policy},
+                                                                   delay{static_cast<double>(policy.initialDelay.count())},
+                                                                   random{::std::random_device{}()} {}
+        virtual ~ReconnectBackoff() {}
+
+        /**
+         * @brief Get the delay before the next attempt
+         *
+         * @return milliseconds
+         */
+        ::std::chrono::milliseconds next()
+        {
+            // Randomize part of the delay
+            const double maxDelay{static_cast<double>(POLICY.maxDelay.count())};
+            const double bounded{delay < maxDelay ? delay : maxDelay};
+            const double jitter{0.0 < POLICY.jitter ? (POLICY.jitter < 1.0 ? POLICY.jitter : 1.0) : 0.0};
+            const double randomized{bounded * (1.0 - jitter * ::std::uniform_real_distribution<double>{0.0, 1.0}(random))};
+
+            // Grow the delay for the next attempt
+            delay = bounded * POLICY.multiplier;
+            return ::std::chrono::milliseconds{static_cast<::std::chrono::milliseconds::rep>(randomized)};
+        }
+
+    private:
+        // Policy the delays follow
+        const ReconnectPolicy POLICY;
+
+        // Delay before randomization
+        double delay;
+
+        // Random generator for the jitter
+        ::std::minstd_rand random;
+
+        // Disallow copy
+        ReconnectBackoff(const ReconnectBackoff &) = delete;
+        ReconnectBackoff &operator=(const ReconnectBackoff &) = delete;
+    };
+}
+
+#endif // RECONNECT_HPP_
@@ -0,0 +1,149 @@
+/**
+ * @file Resolver.hpp
+ * @author Nils Henrich
+ * @brief Thread-safe resolution of server addresses (IPv4 and IPv6) with an optional cache shared by many clients.
+ * @version 3.2.1
+ * @date 2025-02-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef RESOLVER_HPP_
+#define RESOLVER_HPP_
+
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <chrono>
+#include <cstring>
+#include <sys/socket.h>
+#include <netdb.h>
+
+namespace tcp
+{
+    /**
+     * @brief Resolved address of a server
+     */
+    struct ResolvedAddress
+    {
+        struct sockaddr_storage address
+        {
+        };
+        socklen_t length{0};
+        int family{AF_UNSPEC};
+    };
+
+    /**
+     * @brief Resolve a host name or IP address with getaddrinfo (Thread-safe, IPv4 and IPv6)
+     *
+     * @param host
+     * @param port
+     * @param addresses All addresses found, in the order to try them
+     * @return bool (false if the host could not be resolved)
+     */
+    inline bool resolveAddresses(const ::std::string &host, const int port, ::std::vector<ResolvedAddress> &addresses)
+    {
+        struct addrinfo hints
+        {
+        };
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+        hints.ai_flags = AI_ADDRCONFIG;
+
+        struct addrinfo *result{nullptr};
+        if (getaddrinfo(host.c_str(), ::std::to_string(port).c_str(), &hints, &result))
+            return false;
+
+        addresses.clear();
+        for (struct addrinfo *it{result}; it; it = it->ai_next)
+        {
+            ResolvedAddress address;
+            memcpy(&address.address, it->ai_addr, it->ai_addrlen);
+            address.length = it->ai_addrlen;
+            address.family = it->ai_family;
+            addresses.push_back(address);
+        }
+        freeaddrinfo(result);
+        return !addresses.empty();
+    }
+
+    /**
+     * @brief Cache of resolved server addresses, that can be shared by many clients.
+     * Entries expire after a fixed time, failed resolutions are not cached.
+     */
+    class ResolverCache
+    {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * @param ttl   Time resolved addresses are kept (Default: 60 seconds)
+         */
+        explicit ResolverCache(const ::std::chrono::milliseconds ttl = ::std::chrono::seconds{60}) : TTL{ttl} {}
+        virtual ~ResolverCache() {}
+
+        /**
+         * @brief Resolve a host name or IP address (From cache if available and not expired)
+         *
+         * @param host
+         * @param port
+         * @param addresses
+         * @return bool (false if the host could not be resolved)
+         */
+        bool resolve(const ::std::string &host, const int port, ::std::vector<ResolvedAddress> &addresses)
+        {
+            const ::std::string key{host + ":" + ::std::to_string(port)};
+            const auto now{::std::chrono::steady_clock::now()};
+
+            // Get addresses from cache
+            {
+                ::std::lock_guard<::std::mutex> lck{entries_m};
+                auto it{entries.find(key)};
+                if (it != entries.end() && now < it->second.expiresAt)
+                {
+                    addresses = it->second.addresses;
+                    return true;
+                }
+            }
+
+            // Resolve without lock, so other hosts can be resolved in parallel
+            if (!resolveAddresses(host, port, addresses))
+                return false;
+
+            ::std::lock_guard<::std::mutex> lck{entries_m};
+            entries[key] = Entry{addresses, now + TTL};
+            return true;
+        }
+
+        /**
+         * @brief Remove all cached addresses
+         */
+        void clear()
+        {
+            ::std::lock_guard<::std::mutex> lck{entries_m};
+            entries.clear();
+            return;
+        }
+
+    private:
+        // Cached addresses of a host and port
+        struct Entry
+        {
+            ::std::vector<ResolvedAddress> addresses;
+            ::std::chrono::steady_clock::time_point expiresAt;
+        };
+        ::std::map<::std::string, Entry> entries{};
+        ::std::mutex entries_m{};
+
+        // Time resolved addresses are kept
+        const ::std::chrono::milliseconds TTL;
+
+        // Disallow copy
+        ResolverCache(const ResolverCache &) = delete;
+        ResolverCache &operator=(const ResolverCache &) = delete;
+    };
+}
+
+#endif // RESOLVER_HPP_
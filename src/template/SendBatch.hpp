@@ -0,0 +1,88 @@
+/**
+ * @file SendBatch.hpp
+ * @author Nils Henrich
+ * @brief Coalescing of several messages into one write.
+ * Messages sent while a batch is open are collected and written together on flush,
+ * so a burst goes out in full-sized TCP segments and TLS records instead of one small one per message.
+ * @version 3.2.1
+ * @date 2025-02-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef SENDBATCH_HPP_
+#define SENDBATCH_HPP_
+
+#include <functional>
+#include <cstddef>
+
+namespace tcp
+{
+    // Bytes collected in a batch until they are written before flush (Maximum plaintext size of a TLS record)
+    constexpr size_t MAXIMUM_BATCH_SIZE{16384};
+
+    /**
+     * @brief Batch open as long as this guard lives (Flushed on destruction)
+     */
+    class SendBatch
+    {
+    public:
+        /**
+         * @brief Open a batch for messages of a server to a client
+         *
+         * @param server
+         * @param clientId
+         */
+        template <class ServerType>
+        SendBatch(ServerType &server, const int clientId) : flushBatch{[&server, clientId]()
+                                                                       { return server.flush(clientId); }}
+        {
+            server.beginBatch(clientId);
+        }
+
+        /**
+         * @brief Open a batch for messages of a client
+         *
+         * @param client
+         */
+        template <class ClientType>
+        explicit SendBatch(ClientType &client) : flushBatch{[&client]()
+                                                            { return client.flush(); }}
+        {
+            client.beginBatch();
+        }
+
+        /**
+         * @brief Destructor (Flush the batch unless flushed before)
+         */
+        virtual ~SendBatch()
+        {
+            flush();
+        }
+
+        /**
+         * @brief Write all collected messages and close the batch
+         *
+         * @return bool (false if writing failed, true if nothing was left to write)
+         */
+        bool flush()
+        {
+            if (flushed)
+                return true;
+            flushed = true;
+            return flushBatch();
+        }
+
+    private:
+        // Flush of the server or client the batch is open on
+        ::std::function<bool()> flushBatch;
+        bool flushed{false};
+
+        // Disallow copy
+        SendBatch(const SendBatch &) = delete;
+        SendBatch &operator=(const SendBatch &) = delete;
+    };
+}
+
+#endif // SENDBATCH_HPP_
@@ -18,16 +18,30 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <algorithm>
+#include <chrono>
 #include <thread>
 #include <mutex>
 #include <cstring>
 #include <atomic>
 #include <memory>
 #include <functional>
+#include <memory_resource>
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <unistd.h>
 #include "exception.hpp"
+#include "Framing.hpp"
+#include "ReceiveBuffer.hpp"
+#include "BufferPool.hpp"
+#include "Message.hpp"
+#include "ReadPause.hpp"
+#include "SpliceForwarder.hpp"
+#include "Correlation.hpp"
+#include "BusyPoll.hpp"
+#include "Affinity.hpp"
+#include "SocketOptions.hpp"
+#include "SendBatch.hpp"
 
 // Debugging output
 #ifdef DEVELOP
@@ -61,6 +75,24 @@ namespace tcp
         Server_error(::std::string msg = "unexpected server error") : Error{msg} {}
     };
 
+    /**
+     * @brief Metadata of a connected client.
+     * Captured once when the connection is established and never changed afterwards, so it can be read without locking.
+     */
+    struct ConnectionInfo
+    {
+        // IP address and TCP port of the client
+        ::std::string ip;
+        uint16_t port{0};
+
+        // Time the TCP connection was accepted and the time the connection initialization (e.g. TLS handshake) finished
+        ::std::chrono::system_clock::time_point acceptedAt;
+        ::std::chrono::system_clock::time_point establishedAt;
+
+        // Subject parts of the client certificate identified by NID (TLS only, empty if client sent no certificate)
+        ::std::map<int, ::std::string> certSubject;
+    };
+
     /**
      * @brief Class to manage running flag in threads.
      *
@@ -86,25 +118,92 @@ namespace tcp
         Server_running_manager &operator=(const Server_running_manager &) = delete;
     };
 
+    /**
+     * @brief Default handler policy for the Server class.
+     * All workers are stored as std::function and can be exchanged at runtime via the setWorkOn... methods of the server.
+     *
+     * A custom handler policy can be passed as template parameter to the server instead.
+     * It must provide the following methods, that are called directly (and can be inlined) by the server:
+     *  - ::std::ostream *createForwardStream(const int clientId)                   (continuous mode, nullptr for no forwarding)
+     *  - void *established(const int clientId)                                      (returns the user context of the connection)
+     *  - void message(const int clientId, void *context, ::std::string msg)        (fragmentation mode)
+     *  - void closed(const int clientId, void *context)                            (after all message workers are finished)
+     */
+    class ServerCallbacks
+    {
+    public:
+        ::std::ostream *createForwardStream(const int clientId)
+        {
+            return generateNewForwardStream ? generateNewForwardStream(clientId) : nullptr;
+        }
+
+        void *established(const int clientId)
+        {
+            if (workOnEstablished)
+                workOnEstablished(clientId);
+            else if (workOnEstablishedWithContext)
+                return workOnEstablishedWithContext(clientId);
+            return nullptr;
+        }
+
+        void message(const int clientId, void *context, Message msg)
+        {
+            // Spilled message: Pass the mapping of its file instead of copying it into memory (Dropped if mapping fails)
+            if (msg.isSpilled() && workOnSpilledMessage)
+            {
+                if (const char *content{msg.data()})
+                    workOnSpilledMessage(clientId, content, msg.size());
+                return;
+            }
+
+            if (workOnMessage)
+                workOnMessage(clientId, ::std::move(msg).str());
+            else if (workOnMessageWithContext)
+                workOnMessageWithContext(clientId, context, ::std::move(msg).str());
+        }
+
+        void closed(const int clientId, void *context)
+        {
+            if (workOnClosed)
+                workOnClosed(clientId);
+            else if (workOnClosedWithContext)
+                workOnClosedWithContext(clientId, context);
+        }
+
+        // Pointer to a function that returns an out stream to forward incoming data to
+        ::std::function<::std::ostream *(const int)> generateNewForwardStream{nullptr};
+
+        // Pointer to worker functions on incoming message (for fragmentation mode only), established or closed connection
+        ::std::function<void(const int, const ::std::string)> workOnMessage{nullptr};
+        ::std::function<void(const int)> workOnEstablished{nullptr};
+        ::std::function<void(const int)> workOnClosed{nullptr};
+
+        // Pointer to worker function on incoming messages spilled to disk (Content is only valid during the call)
+        ::std::function<void(const int, const char *, const size_t)> workOnSpilledMessage{nullptr};
+
+        // Pointer to worker functions working with a user context per connection
+        ::std::function<void *(const int)> workOnEstablishedWithContext{nullptr};
+        ::std::function<void(const int, void *, const ::std::string)> workOnMessageWithContext{nullptr};
+        ::std::function<void(const int, void *)> workOnClosedWithContext{nullptr};
+    };
+
     /**
      * @brief Template class for the Server class.
      * A usable server class must be derived from this class with specific socket type (int for unencrypted TCP, SSL for TLS).
      *
      * @param SocketType
      * @param SocketDeleter
+     * @param Handler       Handler policy called on server events (Default: Runtime exchangeable std::function workers)
+     * @param Framing       Framing policy separating messages on the stream (Default: Configured at runtime by constructor)
      */
-    template <class SocketType, class SocketDeleter = ::std::default_delete<SocketType>>
+    template <class SocketType, class SocketDeleter = ::std::default_delete<SocketType>, class Handler = ServerCallbacks, class Framing = RuntimeFraming>
     class Server
     {
     public:
         /**
-         * @brief Constructor for continuous stream forwarding
+         * @brief Constructor for continuous stream forwarding (Or for the fixed framing of a compile-time framing policy)
          */
-        Server() : DELIMITER_FOR_FRAGMENTATION{0},
-                   APPEND_STRING_FOR_FRAGMENTATION{0},
-                   APPEND_STRING_FOR_FRAGMENTATION_LENGTH{0},
-                   MAXIMUM_MESSAGE_LENGTH_FOR_FRAGMENTATION{0},
-                   MESSAGE_FRAGMENTATION_ENABLED{false} {}
+        Server() : framing{} {}
 
         /**
          * @brief Constructor for fragmented messages
@@ -113,11 +212,7 @@ namespace tcp
          * @param messageAppend String to append to the end of each fragmented message (before the delimiter)
          * @param messageMaxLen Maximum message length (actual message + length of append string)
          */
-        Server(char delimiter, const ::std::string &messageAppend, size_t messageMaxLen) : DELIMITER_FOR_FRAGMENTATION{delimiter},
-                                                                                           APPEND_STRING_FOR_FRAGMENTATION{messageAppend},
-                                                                                           APPEND_STRING_FOR_FRAGMENTATION_LENGTH{messageAppend.size()},
-                                                                                           MAXIMUM_MESSAGE_LENGTH_FOR_FRAGMENTATION{messageMaxLen},
-                                                                                           MESSAGE_FRAGMENTATION_ENABLED{true} {} // TODO: Add check if messageAppend is too long (more than messageMaxLen bytes)
+        Server(char delimiter, const ::std::string &messageAppend, size_t messageMaxLen) : framing{delimiter, messageAppend, messageMaxLen} {}
 
         /**
          * @brief Destructor
@@ -149,6 +244,45 @@ namespace tcp
          */
         bool sendMsg(const int clientId, const ::std::string &msg);
 
+        /**
+         * @brief Open a batch for messages to a specific client.
+         * All messages sent to the client until flush (From any thread) are collected and written together,
+         * so they go out in full-sized segments and TLS records. Large batches are written in parts early.
+         * A batch left open doesn't send anything, so use the SendBatch guard where possible.
+         *
+         * @param clientId
+         * @return bool (false if the client is not connected)
+         */
+        bool beginBatch(const int clientId);
+
+        /**
+         * @brief Write all messages collected for a specific client and close its batch
+         *
+         * @param clientId
+         * @return bool (false if writing failed, true if no batch was open)
+         */
+        bool flush(const int clientId);
+
+        /**
+         * @brief Send the response to a request of a client (Fragmentation mode only).
+         * Requests can be answered in any order and from any thread.
+         *
+         * @param clientId
+         * @param requestId ID passed to the request worker
+         * @param msg
+         * @return bool (true if successful, false if not)
+         */
+        bool reply(const int clientId, const uint64_t requestId, const ::std::string &msg);
+
+        /**
+         * @brief Set worker executed on each incoming request sent by the request method of a client (Fragmentation mode only).
+         * It gets the client ID, the request ID to reply with and the message without header.
+         * Requests are passed to this worker instead of the message worker if it is set.
+         *
+         * @param worker
+         */
+        void setWorkOnRequest(::std::function<void(const int, const uint64_t, const ::std::string)> worker);
+
         /**
          * @brief Set worker executed on each incoming message in fragmentation mode
          *
@@ -156,6 +290,50 @@ namespace tcp
          */
         void setWorkOnMessage(::std::function<void(const int, const ::std::string)> worker);
 
+        /**
+         * @brief Run message and request workers directly in the receive thread of the connection instead of a new thread per message (Default: false).
+         * This saves starting a thread for each message and keeps messages of a client in order, but the workers must not block:
+         * No data is read from the client while they run. Takes effect on new connections.
+         *
+         * @param enabled
+         */
+        void setInlineMessageWork(const bool enabled);
+
+        /**
+         * @brief Spin on the sockets for incoming data before blocking in a read (Default: disabled).
+         * The receive threads don't sleep while data arrives within the budget, which saves the wake up latency,
+         * but each connection burns a CPU while spinning. The kernel busy polls the sockets as well if supported and permitted.
+         * The receive threads are pinned to the CPUs of the policy. Takes effect on new connections.
+         * Must not be called while a connection is established.
+         *
+         * @param policy
+         */
+        void setBusyPoll(const BusyPollPolicy &policy);
+
+        /**
+         * @brief Block in reads right away (Default). Must not be called while a connection is established.
+         */
+        void disableBusyPoll();
+
+        /**
+         * @brief Pin the acceptor, receive and worker threads to CPUs (Default: Not pinned).
+         * Receive threads can follow the CPU the kernel processes the data of their connection on,
+         * and take their buffers from a pool of their NUMA node. The CPUs of a busy poll policy take precedence for receive threads.
+         * Takes effect on the next start for the acceptor and on new connections otherwise.
+         * Must not be called while a connection is established.
+         *
+         * @param affinity
+         */
+        void setThreadAffinity(const ThreadAffinity &affinity);
+
+        /**
+         * @brief Set the options of the listening socket and all accepted connections (Default: Reuse address only).
+         * Takes effect on the next start.
+         *
+         * @param options
+         */
+        void setSocketOptions(const SocketOptions &options);
+
         /**
          * @brief Set creator creating a forwarding out stream for each established connection in continuous mode
          *
@@ -163,6 +341,24 @@ namespace tcp
          */
         void setCreateForwardStream(::std::function<::std::ostream *(const int)> creator);
 
+        /**
+         * @brief Set creator returning a file descriptor to forward the data of each established connection to in continuous mode (-1 for no forwarding).
+         * The data is moved from the socket to the file descriptor with splice(2) through a pipe, so it never enters user space.
+         * If splicing is not supported by the file descriptor (e.g. a file opened with O_APPEND), the data is copied with read and write instead.
+         * Used instead of the data worker and the forward stream. Only supported by unencrypted TCP servers, ignored otherwise.
+         * The file descriptor is closed by the server when the connection is closed. If writing to it fails, the connection is closed.
+         *
+         * @param creator
+         */
+        void setCreateSpliceTarget(::std::function<int(const int)> creator);
+
+        /**
+         * @brief Get the number of bytes forwarded to splice targets, moved with splice and copied as fallback (All connections)
+         *
+         * @return SpliceStats
+         */
+        SpliceStats getSpliceStats() const;
+
         /**
          * @brief Set worker executed on each new established connection
          *
@@ -177,6 +373,162 @@ namespace tcp
          */
         void setWorkOnClosed(::std::function<void(const int)> worker);
 
+        /**
+         * @brief Set worker executed on each new established connection, returning an opaque user context for this connection.
+         *        The context is kept with the connection and passed to the context aware message and closed workers,
+         *        so they don't need to look up their session state by client ID.
+         *        Replaces the worker set by setWorkOnEstablished.
+         *
+         * @param worker
+         */
+        void setWorkOnEstablishedWithContext(::std::function<void *(const int)> worker);
+
+        /**
+         * @brief Set worker executed on each incoming message in fragmentation mode, receiving the user context of the connection.
+         *        Replaces the worker set by setWorkOnMessage.
+         *
+         * @param worker
+         */
+        void setWorkOnMessageWithContext(::std::function<void(const int, void *, const ::std::string)> worker);
+
+        /**
+         * @brief Set worker executed on each closed connection, receiving the user context of the connection.
+         *        This is the place to release the context. All message workers of this connection are finished at this point.
+         *        Replaces the worker set by setWorkOnClosed.
+         *
+         * @param worker
+         */
+        void setWorkOnClosedWithContext(::std::function<void(const int, void *)> worker);
+
+        /**
+         * @brief Set a fixed size for the receive buffer of each connection (Default: 16384 bytes).
+         * Larger chunks need fewer reads for bulk transfers, smaller chunks save memory for many idle connections.
+         * Takes effect for connections established afterwards. Throw Server_error if size is 0.
+         *
+         * @param chunkSize
+         */
+        void setReceiveChunkSize(const size_t chunkSize);
+
+        /**
+         * @brief Let the receive buffer of each connection adapt its size to the observed reads.
+         * The buffer starts with the minimum size, grows when reads fill it completely and shrinks when reads stay small.
+         * Takes effect for connections established afterwards. Throw Server_error if minimum size is 0 or greater than maximum size.
+         *
+         * @param minChunkSize
+         * @param maxChunkSize
+         */
+        void setReceiveChunkSizeAdaptive(const size_t minChunkSize, const size_t maxChunkSize);
+
+        /**
+         * @brief Set the memory resource receive buffers are taken from (Default: new/delete).
+         * Released buffers are kept in a size-classed pool of this server and only new ones are requested from this resource.
+         * Must be called while no connection is active. Throw Error if buffers are still in use.
+         *
+         * @param resource
+         */
+        void setMemoryResource(::std::pmr::memory_resource *resource);
+
+        /**
+         * @brief Get the counters of the receive buffer pool (Hits, misses, bytes in use and bytes cached)
+         *
+         * @return BufferPoolStats
+         */
+        BufferPoolStats getBufferPoolStats() const;
+
+        /**
+         * @brief Set worker executed when an incoming message exceeds the maximum message length in fragmentation mode.
+         * The message is dropped and its remaining data is skipped until the next delimiter, so it is never buffered completely.
+         * The worker runs in the receive thread of the connection and should return quickly.
+         *
+         * @param worker
+         */
+        void setWorkOnOversizedMessage(::std::function<void(const int)> worker);
+
+        /**
+         * @brief Spill incoming messages to disk while reassembling them once they exceed a threshold in fragmentation mode.
+         * A spilled message is written to an unlinked temporary file in the given directory instead of growing in memory.
+         * A handler policy taking the message type gets a read-only mapping of this file (see BasicMessage::view()),
+         * so does the worker set by setWorkOnSpilledMessage. Without this worker, string based workers still get a copy in memory.
+         * If writing fails, the message is dropped.
+         * Takes effect for messages received afterwards. A threshold of 0 disables spilling (Default).
+         *
+         * @param threshold
+         * @param directory
+         */
+        void setSpillToDisk(const size_t threshold, const ::std::string &directory = "/var/tmp");
+
+        /**
+         * @brief Set worker executed on each incoming message spilled to disk (see setSpillToDisk) instead of the message worker.
+         * The worker gets a read-only mapping of the spill file, so the message is never copied into memory.
+         * The content is only valid during the call. If mapping fails, the message is dropped.
+         *
+         * @param worker
+         */
+        void setWorkOnSpilledMessage(::std::function<void(const int, const char *, const size_t)> worker);
+
+        /**
+         * @brief Get the number of incoming messages dropped for exceeding the maximum message length (All connections)
+         *
+         * @return uint64_t
+         */
+        uint64_t getOversizedMessageCount() const;
+
+        /**
+         * @brief Set workers receiving incoming messages in fragmentation mode piece by piece while they arrive (Instead of the message worker).
+         * Large messages are never buffered completely, so memory stays constant and processing overlaps with the transfer.
+         * All workers run in the receive thread of the connection in message order.
+         * The chunk data is only valid during the call of the chunk worker.
+         * The end worker gets true if the message is complete, or false if it is dropped for exceeding the maximum message length or the connection is closed.
+         * Passing no chunk worker switches back to delivering whole messages.
+         *
+         * @param begin Worker called before the first chunk of a message (Optional)
+         * @param chunk Worker called for each received part of a message
+         * @param end   Worker called after the last chunk of a message (Optional)
+         */
+        void setWorkOnMessageStream(::std::function<void(const int)> begin,
+                                    ::std::function<void(const int, const char *, const size_t)> chunk,
+                                    ::std::function<void(const int, const bool)> end);
+
+        /**
+         * @brief Set worker getting the raw incoming data in continuous mode instead of the forward streams.
+         * The data is passed as received, without going through an ostream and without flushing per chunk.
+         * With a batch size, several reads are collected and passed at once until the batch size is reached
+         * or no more data is waiting on the connection, so the worker is called less often without delaying data.
+         * The data is only valid during the call. The worker runs in the receive thread of the connection.
+         * Takes effect for connections established afterwards. Passing no worker switches back to the forward stream.
+         *
+         * @param worker
+         * @param batchSize Minimum number of bytes per call while more data is waiting (Default: 0 = Pass each read directly)
+         */
+        void setWorkOnData(::std::function<void(const int, const char *, const size_t)> worker, const size_t batchSize = 0);
+
+        /**
+         * @brief Stop reading from a client until resumeReading is called.
+         * Data not read stays in the kernel receive buffer, so the TCP receive window throttles the client instead of the server buffering it.
+         * A slow consumer (e.g. the data worker) can call this to signal that it would block and resume from another thread once it caught up.
+         * Takes effect before the next read (A read already waiting for data still completes). While reading is paused, a closed connection is only noticed after resuming.
+         *
+         * @param clientId
+         * @return bool (true if client is connected, false if not)
+         */
+        bool pauseReading(const int clientId);
+
+        /**
+         * @brief Continue reading from a client paused by pauseReading
+         *
+         * @param clientId
+         * @return bool (true if client is connected, false if not)
+         */
+        bool resumeReading(const int clientId);
+
+        /**
+         * @brief Get the handler policy called on server events.
+         * Can be used to configure a custom handler policy before starting the server.
+         *
+         * @return Handler&
+         */
+        Handler &getHandler();
+
         /**
          * @brief Get all connected clients identified by ID as list
          *
@@ -184,6 +536,23 @@ namespace tcp
          */
         ::std::vector<int> getAllClientIds() const;
 
+        /**
+         * @brief Get an immutable snapshot of all connected client IDs (sorted ascending).
+         * The snapshot is only rebuilt when a connection is added or removed, so reading it never touches the connection map.
+         *
+         * @return shared_ptr<const vector<int>>
+         */
+        ::std::shared_ptr<const ::std::vector<int>> getClientIdsSnapshot() const;
+
+        /**
+         * @brief Call visitor for each connected client (Identified by its TCP ID) without allocating.
+         * The visited set is the snapshot at the moment of calling, so clients may connect or disconnect meanwhile.
+         *
+         * @param visitor   Callable taking the client ID (const int)
+         */
+        template <class Visitor>
+        void forEachClient(Visitor &&visitor) const;
+
         /**
          * @brief Get the IP address of a specific connected client (Identified by its TCP ID).
          *        Throw Server_error if client ID is not found.
@@ -193,6 +562,16 @@ namespace tcp
          */
         ::std::string getClientIp(const int clientId) const;
 
+        /**
+         * @brief Get the metadata of a specific connected client (Identified by its TCP ID).
+         *        The metadata is captured when the connection is established, so this call needs no syscall and no lock.
+         *        Throw Server_error if client ID is not found.
+         *
+         * @param clientId
+         * @return shared_ptr<const ConnectionInfo>
+         */
+        ::std::shared_ptr<const ConnectionInfo> getClientInfo(const int clientId) const;
+
         /**
          * @brief Return if server is running
          *
@@ -228,14 +607,44 @@ namespace tcp
         virtual void connectionDeinit(SocketType *socket) = 0;
 
         /**
-         * @brief Read raw received data from a specific client (Identified by its TCP ID).
-         * This method is expected to return the read raw data as a string with blocking read (Empty string means failure).
+         * @brief Add protocol specific metadata to a newly established connection (e.g. certificate subject).
+         * IP address, port and timestamps are already set when this method is called.
+         * This method does nothing by default and can be overridden by derived classes.
+         *
+         * @param socket
+         * @param info
+         */
+        virtual void readConnectionInfo(SocketType *, ConnectionInfo &) {}
+
+        /**
+         * @brief Read raw received data from a specific client (Identified by its TCP ID) into a given buffer.
+         * This method is expected to block until data is available and return the number of bytes read (0 or less means failure).
+         * The buffer is owned by the receive thread of the connection and reused for every read, so it is not zeroed.
          * This method is abstract and must be implemented by derived classes.
          *
          * @param socket
-         * @return string
+         * @param buffer    Buffer to read into
+         * @param size      Size of the buffer
+         * @return ssize_t
          */
-        virtual ::std::string readMsg(SocketType *socket) = 0;
+        virtual ssize_t readMsg(SocketType *socket, char *buffer, size_t size) = 0;
+
+        /**
+         * @brief Check if the socket of a connection carries the plain data, so it can be spliced to a file descriptor directly.
+         * Not supported by default, derived classes for unencrypted connections override this.
+         *
+         * @return bool
+         */
+        virtual bool spliceSupported() const { return false; }
+
+        /**
+         * @brief Check if decrypted data is buffered by a connection, so a read returns without waiting for the socket.
+         * Never by default, derived classes for encrypted connections override this.
+         *
+         * @param socket
+         * @return bool
+         */
+        virtual bool pendingData(SocketType *) const { return false; }
 
         /**
          * @brief Send raw data to a specific client (Identified by its TCP ID).
@@ -248,16 +657,33 @@ namespace tcp
          */
         virtual bool writeMsg(const int clientId, const ::std::string &msg) = 0;
 
+        /**
+         * @brief Send collected messages of a batch to a specific client.
+         * Same as writeMsg by default, derived classes can hold back a partly filled segment if more data follows.
+         *
+         * @param clientId
+         * @param data
+         * @param more  More data of the batch follows
+         * @return bool
+         */
+        virtual bool writeBatch(const int clientId, const ::std::string &data, const bool) { return writeMsg(clientId, data); }
+
         // Map to store all active connections with their identifying TCP ID
         ::std::map<int, ::std::unique_ptr<SocketType, SocketDeleter>> activeConnections{};
 
         // Mutex to protect the activeConnections map
         ::std::mutex activeConnections_m{};
 
-        // Maximum TCP packet size
-        const static int MAXIMUM_RECEIVE_PACKAGE_SIZE{16384};
-
     private:
+        // Message type passed to the handler policy (Inline storage for small messages)
+        using MessageType = typename HandlerMessageType<Handler>::type;
+
+        /**
+         * @brief Rebuild and publish the client snapshot from activeConnections and connectionInfos.
+         * Must be called with activeConnections_m locked.
+         */
+        void publishClients();
+
         /**
          * @brief Listen for new connections requests.
          * This method runs infinitely in a separate thread while the server is running.
@@ -272,6 +698,67 @@ namespace tcp
          */
         void listenMessage(const int clientId, RunningFlag *const recRunning_p);
 
+        /**
+         * @brief Count and report an incoming message exceeding the maximum message length
+         *
+         * @param clientId
+         */
+        void reportOversizedMessage(const int clientId);
+
+        /**
+         * @brief Pass a received message to the request worker if it is a request
+         *
+         * @param clientId
+         * @param buffer
+         * @return bool (false if the message is no request or no request worker is set)
+         */
+        bool handleRequest(const int clientId, MessageType &buffer);
+
+        /**
+         * @brief Get the receive buffer pool of the NUMA node the calling thread runs on (Created on first use)
+         *
+         * @return BufferPool&
+         */
+        BufferPool &localBufferPool();
+
+        /**
+         * @brief Append a received part to the message buffer (Spill the message to disk if it exceeds the spill threshold)
+         *
+         * @param clientId
+         * @param buffer
+         * @param part
+         * @param len
+         * @return bool (False if the message could not be stored and is dropped)
+         */
+        bool appendMessagePart(const int clientId, MessageType &buffer, const char *part, const size_t len);
+
+        // State of the message currently streamed on a connection
+        struct MessageStreamState
+        {
+            bool inMessage{false};
+            bool skipping{false};
+            size_t length{0};
+        };
+
+        /**
+         * @brief Pass a received part of a message to the streaming workers (Begin the message if it is the first part)
+         *
+         * @param clientId
+         * @param part
+         * @param len
+         * @param state
+         */
+        void streamMessagePart(const int clientId, const char *part, const size_t len, MessageStreamState &state);
+
+        /**
+         * @brief End the message currently streamed (At a delimiter or if the connection is closed)
+         *
+         * @param clientId
+         * @param state
+         * @param complete  True at a delimiter, false if the connection is closed
+         */
+        void streamMessageEnd(const int clientId, MessageStreamState &state, const bool complete);
+
         // Socket address for the server
         struct sockaddr_in socketAddress
         {
@@ -290,27 +777,79 @@ namespace tcp
         // Flag to indicate if the server is running
         RunningFlag running{false};
 
-        // Pointer to a function that returns an out stream to forward incoming data to
-        ::std::function<::std::ostream *(const int)> generateNewForwardStream{nullptr};
-        ::std::map<int, ::std::unique_ptr<::std::ostream>> forwardStreams;
+        // Metadata of all active connections (Protected by activeConnections_m)
+        ::std::map<int, ::std::shared_ptr<const ConnectionInfo>> connectionInfos{};
 
-        // Pointer to worker functions on incoming message (for fragmentation mode only), established or closed connection
-        ::std::function<void(const int, const ::std::string)> workOnMessage{nullptr};
-        ::std::function<void(const int)> workOnEstablished{nullptr};
-        ::std::function<void(const int)> workOnClosed{nullptr};
+        // Creator of the splice target of each connection and forwarding counters
+        ::std::function<int(const int)> createSpliceTarget{nullptr};
+        ::std::atomic<uint64_t> splicedBytes{0};
+        ::std::atomic<uint64_t> copiedBytes{0};
+
+        // Read pause state of all active connections (Protected by activeConnections_m, shared with the receive thread)
+        ::std::map<int, ::std::shared_ptr<ReadPause>> readPauses{};
+
+        // Messages collected for clients with an open batch (Protected by activeConnections_m)
+        ::std::map<int, ::std::string> sendBatches{};
+
+        // Immutable snapshot of all connected clients (Replaced atomically on connect and disconnect)
+        // IDs are sorted ascending, infos[i] belongs to ids[i]
+        struct ClientSnapshot
+        {
+            ::std::vector<int> ids;
+            ::std::vector<::std::shared_ptr<const ConnectionInfo>> infos;
+        };
+        ::std::shared_ptr<const ClientSnapshot> clients{::std::make_shared<const ClientSnapshot>()};
+
+        // Size bounds of the receive buffer (Equal for fixed size)
+        size_t receiveChunkSizeMin{DEFAULT_RECEIVE_CHUNK_SIZE};
+        size_t receiveChunkSizeMax{DEFAULT_RECEIVE_CHUNK_SIZE};
+
+        // Pool the receive buffers are allocated from
+        BufferPool bufferPool{};
+
+        // Worker and counter for incoming messages exceeding the maximum message length
+        ::std::function<void(const int)> workOnOversizedMessage{nullptr};
+        ::std::atomic<uint64_t> oversizedMessages{0};
+
+        // Message size from which incoming messages are spilled to disk (0 = Disabled) and directory for the spill files
+        size_t spillThreshold{0};
+        ::std::string spillDirectory{};
+
+        // Workers for streaming delivery of incoming messages (Used instead of the message worker if a chunk worker is set)
+        ::std::function<void(const int)> workOnMessageBegin{nullptr};
+        ::std::function<void(const int, const char *, const size_t)> workOnMessageChunk{nullptr};
+        ::std::function<void(const int, const bool)> workOnMessageEnd{nullptr};
 
-        // Delimiter for the message framing (incoming and outgoing)
-        const char DELIMITER_FOR_FRAGMENTATION;
+        // Worker for raw incoming data in continuous mode (Used instead of the forward stream if set) and its batch size
+        ::std::function<void(const int, const char *, const size_t)> workOnData{nullptr};
+        size_t dataBatchSize{0};
 
-        // Append this string to the end of each outgoing fragmented message
-        const ::std::string APPEND_STRING_FOR_FRAGMENTATION;
-        const size_t APPEND_STRING_FOR_FRAGMENTATION_LENGTH;
+        // Run message and request workers in the receive thread (No thread per message)
+        ::std::atomic<bool> inlineMessageWork{false};
 
-        // Maximum message length (incoming and outgoing)
-        const size_t MAXIMUM_MESSAGE_LENGTH_FOR_FRAGMENTATION;
+        // Busy poll configuration (Only used if enabled)
+        bool busyPollEnabled{false};
+        BusyPollPolicy busyPollPolicy{};
 
-        // Flag if messages shall be fragmented
-        const bool MESSAGE_FRAGMENTATION_ENABLED;
+        // CPUs of acceptor, receive and worker threads
+        ThreadAffinity threadAffinity{};
+
+        // Options of listening and accepted sockets
+        SocketOptions socketOptions{};
+
+        // Receive buffer pools per NUMA node (Only used if NUMA local buffers are enabled)
+        ::std::map<int, ::std::unique_ptr<BufferPool>> nodeBufferPools{};
+        ::std::pmr::memory_resource *bufferUpstream{::std::pmr::new_delete_resource()};
+        mutable ::std::mutex nodeBufferPools_m{};
+
+        // Worker for incoming requests (Used instead of the message worker for requests if set)
+        ::std::function<void(const int, const uint64_t, const ::std::string)> workOnRequest{nullptr};
+
+        // Handler policy called on established connections, incoming messages and closed connections
+        Handler handler{};
+
+        // Framing policy (Delimiter, append string and maximum length of messages)
+        const Framing framing;
 
         // Disallow copy
         Server(const Server &) = delete;
@@ -320,8 +859,8 @@ namespace tcp
     // ============================== Implementation of non-abstract methods. ==============================
     // ====================== Must be in header file because of the template class. =======================
 
-    template <class SocketType, class SocketDeleter>
-    int Server<SocketType, SocketDeleter>::start(const int port)
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    int Server<SocketType, SocketDeleter, Handler, Framing>::start(const int port)
     {
         // If the server is already running, return error
         if (running)
@@ -364,10 +903,9 @@ namespace tcp
         }
 
         // Set options on the TCP socket for the server to accept new connections.
-        // (Reuse address)
+        // (Reuse address and buffer sizes, accepted connections get the others)
         // Return error if it fails
-        int opt{0};
-        if (setsockopt(tcpSocket, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt)))
+        if (!applyListenSocketOptions(tcpSocket, socketOptions))
         {
 #ifdef DEVELOP
             ::std::cerr << DEBUGINFO << ": Error when setting TCP socket options" << ::std::endl;
@@ -400,7 +938,7 @@ namespace tcp
         }
 
         // Start listening on the TCP socket for the server to accept new connections.
-        if (listen(tcpSocket, SOMAXCONN))
+        if (listen(tcpSocket, socketOptions.backlog))
         {
 #ifdef DEVELOP
             ::std::cerr << DEBUGINFO << ": Error when starting listening" << ::std::endl;
@@ -413,12 +951,11 @@ namespace tcp
         }
 
         // Start the thread to accept new connections
+        // The server is marked as running before, because the accept loop ends as soon as it sees the server not running
         if (accHandler.joinable())
             throw Server_error("Start server thread failed: Thread is already running");
-        accHandler = ::std::thread{&Server::listenConnection, this};
-
-        // Server is now running
         running = true;
+        accHandler = ::std::thread{&Server::listenConnection, this};
 
 #ifdef DEVELOP
         ::std::cout << DEBUGINFO << ": Server started on port " << port << ::std::endl;
@@ -427,8 +964,8 @@ namespace tcp
         return initCode;
     }
 
-    template <class SocketType, class SocketDeleter>
-    void Server<SocketType, SocketDeleter>::stop()
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::stop()
     {
         // Stop the server
         running = false;
@@ -454,13 +991,13 @@ namespace tcp
         return;
     }
 
-    template <class SocketType, class SocketDeleter>
-    bool Server<SocketType, SocketDeleter>::sendMsg(const int clientId, const ::std::string &msg)
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    bool Server<SocketType, SocketDeleter, Handler, Framing>::sendMsg(const int clientId, const ::std::string &msg)
     {
-        if (MESSAGE_FRAGMENTATION_ENABLED)
+        if (framing.enabled())
         {
             // Check if message doesn't contain delimiter
-            if (msg.find(DELIMITER_FOR_FRAGMENTATION) != ::std::string::npos)
+            if (msg.find(framing.delimiter()) != ::std::string::npos)
             {
 #ifdef DEVELOP
                 ::std::cerr << DEBUGINFO << ": Message contains delimiter" << ::std::endl;
@@ -470,7 +1007,7 @@ namespace tcp
             }
 
             // Check if message is too long
-            if (msg.length() > MAXIMUM_MESSAGE_LENGTH_FOR_FRAGMENTATION + APPEND_STRING_FOR_FRAGMENTATION_LENGTH)
+            if (msg.length() > framing.maxLength() + framing.appendLength())
             {
 #ifdef DEVELOP
                 ::std::cerr << DEBUGINFO << ": Message is too long" << ::std::endl;
@@ -483,7 +1020,18 @@ namespace tcp
         // Extend message with start and end characters and send it
         ::std::lock_guard<::std::mutex> lck{activeConnections_m};
         if (activeConnections.find(clientId) != activeConnections.end())
-            return writeMsg(clientId, MESSAGE_FRAGMENTATION_ENABLED ? msg + APPEND_STRING_FOR_FRAGMENTATION + ::std::string{DELIMITER_FOR_FRAGMENTATION} : msg);
+        {
+            // Collect the message if a batch is open (Write the collected messages early if they get too large)
+            auto batch{sendBatches.find(clientId)};
+            if (batch == sendBatches.end())
+                return writeMsg(clientId, framing.enabled() ? framing.frame(msg) : msg);
+            batch->second += framing.enabled() ? framing.frame(msg) : msg;
+            if (MAXIMUM_BATCH_SIZE > batch->second.size())
+                return true;
+            const bool written{writeBatch(clientId, batch->second, true)};
+            batch->second.clear();
+            return written;
+        }
 
 #ifdef DEVELOP
         ::std::cerr << DEBUGINFO << ": Client " << clientId << " is not connected" << ::std::endl;
@@ -492,68 +1040,355 @@ namespace tcp
         return false;
     }
 
-    template <class SocketType, class SocketDeleter>
-    void Server<SocketType, SocketDeleter>::setWorkOnMessage(::std::function<void(const int, const ::std::string)> worker)
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    bool Server<SocketType, SocketDeleter, Handler, Framing>::beginBatch(const int clientId)
+    {
+        ::std::lock_guard<::std::mutex> lck{activeConnections_m};
+        if (activeConnections.find(clientId) == activeConnections.end())
+        {
+#ifdef DEVELOP
+            ::std::cerr << DEBUGINFO << ": Client " << clientId << " is not connected" << ::std::endl;
+#endif // DEVELOP
+
+            return false;
+        }
+
+        // Open the batch (Keep it if it is open already)
+        if (sendBatches.find(clientId) == sendBatches.end())
+            sendBatches[clientId].reserve(MAXIMUM_BATCH_SIZE);
+        return true;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    bool Server<SocketType, SocketDeleter, Handler, Framing>::flush(const int clientId)
+    {
+        ::std::lock_guard<::std::mutex> lck{activeConnections_m};
+        auto batch{sendBatches.find(clientId)};
+        if (batch == sendBatches.end())
+            return true;
+
+        // Write collected messages (Messages sent afterwards are written directly)
+        const bool written{batch->second.empty() || writeBatch(clientId, batch->second, false)};
+        sendBatches.erase(batch);
+        return written;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    bool Server<SocketType, SocketDeleter, Handler, Framing>::reply(const int clientId, const uint64_t requestId, const ::std::string &msg)
+    {
+        // Send the response with the ID of its request
+        return sendMsg(clientId, encodeCorrelated(requestId, msg));
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::setWorkOnRequest(::std::function<void(const int, const uint64_t, const ::std::string)> worker)
+    {
+        workOnRequest = worker;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::setWorkOnMessage(::std::function<void(const int, const ::std::string)> worker)
+    {
+        handler.workOnMessage = worker;
+        handler.workOnMessageWithContext = nullptr;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::setInlineMessageWork(const bool enabled)
+    {
+        inlineMessageWork = enabled;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::setBusyPoll(const BusyPollPolicy &policy)
+    {
+        busyPollPolicy = policy;
+        busyPollEnabled = true;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::disableBusyPoll()
+    {
+        busyPollEnabled = false;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::setThreadAffinity(const ThreadAffinity &affinity)
+    {
+        threadAffinity = affinity;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::setSocketOptions(const SocketOptions &options)
+    {
+        socketOptions = options;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::setCreateForwardStream(::std::function<::std::ostream *(const int)> creator)
+    {
+        handler.generateNewForwardStream = creator;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::setWorkOnEstablished(::std::function<void(const int)> worker)
+    {
+        handler.workOnEstablished = worker;
+        handler.workOnEstablishedWithContext = nullptr;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::setWorkOnClosed(::std::function<void(const int)> worker)
+    {
+        handler.workOnClosed = worker;
+        handler.workOnClosedWithContext = nullptr;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::setWorkOnEstablishedWithContext(::std::function<void *(const int)> worker)
     {
-        workOnMessage = worker;
+        handler.workOnEstablishedWithContext = worker;
+        handler.workOnEstablished = nullptr;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::setWorkOnMessageWithContext(::std::function<void(const int, void *, const ::std::string)> worker)
+    {
+        handler.workOnMessageWithContext = worker;
+        handler.workOnMessage = nullptr;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::setWorkOnClosedWithContext(::std::function<void(const int, void *)> worker)
+    {
+        handler.workOnClosedWithContext = worker;
+        handler.workOnClosed = nullptr;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::setReceiveChunkSize(const size_t chunkSize)
+    {
+        setReceiveChunkSizeAdaptive(chunkSize, chunkSize);
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::setReceiveChunkSizeAdaptive(const size_t minChunkSize, const size_t maxChunkSize)
+    {
+        // Check chunk size bounds
+        if (0 == minChunkSize || minChunkSize > maxChunkSize)
+            throw Server_error("Invalid receive chunk size: " + ::std::to_string(minChunkSize) + " to " + ::std::to_string(maxChunkSize) + " bytes");
+
+        receiveChunkSizeMin = minChunkSize;
+        receiveChunkSizeMax = maxChunkSize;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::setMemoryResource(::std::pmr::memory_resource *resource)
+    {
+        bufferPool.setUpstream(resource);
+
+        // Pools of NUMA nodes get their blocks from the same resource
+        ::std::lock_guard<::std::mutex> lck{nodeBufferPools_m};
+        bufferUpstream = resource ? resource : ::std::pmr::new_delete_resource();
+        for (auto &it : nodeBufferPools)
+            it.second->setUpstream(resource);
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    BufferPoolStats Server<SocketType, SocketDeleter, Handler, Framing>::getBufferPoolStats() const
+    {
+        // Sum up the shared pool and the pools of all NUMA nodes
+        BufferPoolStats stats{bufferPool.getStats()};
+        ::std::lock_guard<::std::mutex> lck{nodeBufferPools_m};
+        for (auto &it : nodeBufferPools)
+        {
+            const BufferPoolStats nodeStats{it.second->getStats()};
+            stats.hits += nodeStats.hits;
+            stats.misses += nodeStats.misses;
+            stats.bytesInUse += nodeStats.bytesInUse;
+            stats.bytesCached += nodeStats.bytesCached;
+        }
+        return stats;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::setWorkOnOversizedMessage(::std::function<void(const int)> worker)
+    {
+        workOnOversizedMessage = worker;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    uint64_t Server<SocketType, SocketDeleter, Handler, Framing>::getOversizedMessageCount() const
+    {
+        return oversizedMessages.load(::std::memory_order_relaxed);
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::setSpillToDisk(const size_t threshold, const ::std::string &directory)
+    {
+        spillThreshold = threshold;
+        spillDirectory = directory;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::setWorkOnSpilledMessage(::std::function<void(const int, const char *, const size_t)> worker)
+    {
+        handler.workOnSpilledMessage = worker;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::setWorkOnMessageStream(::std::function<void(const int)> begin,
+                                                                                     ::std::function<void(const int, const char *, const size_t)> chunk,
+                                                                                     ::std::function<void(const int, const bool)> end)
+    {
+        workOnMessageBegin = begin;
+        workOnMessageChunk = chunk;
+        workOnMessageEnd = end;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::setWorkOnData(::std::function<void(const int, const char *, const size_t)> worker, const size_t batchSize)
+    {
+        workOnData = worker;
+        dataBatchSize = batchSize;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::setCreateSpliceTarget(::std::function<int(const int)> creator)
+    {
+        createSpliceTarget = creator;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    SpliceStats Server<SocketType, SocketDeleter, Handler, Framing>::getSpliceStats() const
+    {
+        SpliceStats stats;
+        stats.splicedBytes = splicedBytes.load(::std::memory_order_relaxed);
+        stats.copiedBytes = copiedBytes.load(::std::memory_order_relaxed);
+        return stats;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    bool Server<SocketType, SocketDeleter, Handler, Framing>::pauseReading(const int clientId)
+    {
+        ::std::lock_guard<::std::mutex> lck{activeConnections_m};
+        auto it{readPauses.find(clientId)};
+        if (it == readPauses.end())
+            return false;
+        it->second->pause();
+        return true;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    bool Server<SocketType, SocketDeleter, Handler, Framing>::resumeReading(const int clientId)
+    {
+        ::std::lock_guard<::std::mutex> lck{activeConnections_m};
+        auto it{readPauses.find(clientId)};
+        if (it == readPauses.end())
+            return false;
+        it->second->resume();
+        return true;
     }
 
-    template <class SocketType, class SocketDeleter>
-    void Server<SocketType, SocketDeleter>::setCreateForwardStream(::std::function<::std::ostream *(const int)> creator)
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    Handler &Server<SocketType, SocketDeleter, Handler, Framing>::getHandler()
     {
-        generateNewForwardStream = creator;
+        return handler;
     }
 
-    template <class SocketType, class SocketDeleter>
-    void Server<SocketType, SocketDeleter>::setWorkOnEstablished(::std::function<void(const int)> worker)
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    std::vector<int> Server<SocketType, SocketDeleter, Handler, Framing>::getAllClientIds() const
     {
-        workOnEstablished = worker;
+        return *getClientIdsSnapshot();
     }
 
-    template <class SocketType, class SocketDeleter>
-    void Server<SocketType, SocketDeleter>::setWorkOnClosed(::std::function<void(const int)> worker)
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    ::std::shared_ptr<const ::std::vector<int>> Server<SocketType, SocketDeleter, Handler, Framing>::getClientIdsSnapshot() const
     {
-        workOnClosed = worker;
+        // Share ownership with the whole snapshot, but only expose the ID list
+        ::std::shared_ptr<const ClientSnapshot> snapshot{::std::atomic_load(&clients)};
+        return ::std::shared_ptr<const ::std::vector<int>>{snapshot, &snapshot->ids};
     }
 
-    template <class SocketType, class SocketDeleter>
-    std::vector<int> Server<SocketType, SocketDeleter>::getAllClientIds() const
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    template <class Visitor>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::forEachClient(Visitor &&visitor) const
     {
-        ::std::vector<int> ret;
-        for (auto &v : activeConnections)
-            ret.push_back(v.first);
-        return ret;
+        // Hold the snapshot for the whole iteration, so it can't be freed by a concurrent update
+        const ::std::shared_ptr<const ClientSnapshot> snapshot{::std::atomic_load(&clients)};
+        for (const int clientId : snapshot->ids)
+            visitor(clientId);
     }
 
-    template <class SocketType, class SocketDeleter>
-    std::string Server<SocketType, SocketDeleter>::getClientIp(const int clientId) const
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::publishClients()
     {
-        struct sockaddr_in addr;
-        socklen_t addrSize = sizeof(struct sockaddr_in);
-        if (getpeername(clientId, (struct sockaddr *)&addr, &addrSize))
+        // Map is ordered, so the snapshot is sorted as well
+        ::std::shared_ptr<ClientSnapshot> snapshot{::std::make_shared<ClientSnapshot>()};
+        snapshot->ids.reserve(connectionInfos.size());
+        snapshot->infos.reserve(connectionInfos.size());
+        for (const auto &it : connectionInfos)
+        {
+            snapshot->ids.push_back(it.first);
+            snapshot->infos.push_back(it.second);
+        }
+        ::std::atomic_store(&clients, ::std::shared_ptr<const ClientSnapshot>{::std::move(snapshot)});
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    std::string Server<SocketType, SocketDeleter, Handler, Framing>::getClientIp(const int clientId) const
+    {
+        return getClientInfo(clientId)->ip;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    ::std::shared_ptr<const ConnectionInfo> Server<SocketType, SocketDeleter, Handler, Framing>::getClientInfo(const int clientId) const
+    {
+        // Search client in the sorted snapshot
+        const ::std::shared_ptr<const ClientSnapshot> snapshot{::std::atomic_load(&clients)};
+        const auto it{::std::lower_bound(snapshot->ids.begin(), snapshot->ids.end(), clientId)};
+        if (it == snapshot->ids.end() || *it != clientId)
         {
 #ifdef DEVELOP
-            ::std::cerr << DEBUGINFO << ": Error reading client " << clientId << "'s IP address" << ::std::endl;
+            ::std::cerr << DEBUGINFO << ": No connected client " << clientId << ::std::endl;
 #endif // DEVELOP
 
-            throw Server_error("Error reading client's IP address");
+            throw Server_error("No connected client " + ::std::to_string(clientId) + " to read connection info from");
         }
 
-        // Convert the IP address to a string and return it
-        return ::std::string{inet_ntoa(addr.sin_addr)};
+        return snapshot->infos[it - snapshot->ids.begin()];
     }
 
-    template <class SocketType, class SocketDeleter>
-    void Server<SocketType, SocketDeleter>::listenConnection()
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::listenConnection()
     {
-        // Get the size of the socket address for the server (important for connection establishment)
-        socklen_t socketAddress_len{sizeof(socketAddress)};
+        // Keep the acceptor on its CPUs
+        pinCurrentThread(threadAffinity.acceptor);
 
         // Accept new connections while the server is running
         while (running)
         {
             // Wait for a new connection to accept
-            const int newConnection{accept(tcpSocket, (struct sockaddr *)&socketAddress, &socketAddress_len)};
+            struct sockaddr_in peerAddress
+            {
+            };
+            socklen_t peerAddress_len{sizeof(peerAddress)};
+            const int newConnection{accept(tcpSocket, (struct sockaddr *)&peerAddress, &peerAddress_len)};
 
             // If new accepted connection ID is -1, the accept failed
             // In this case, continue with accepting the new connections
@@ -564,15 +1399,36 @@ namespace tcp
             ::std::cout << DEBUGINFO << ": New client connected: " << newConnection << ::std::endl;
 #endif // DEVELOP
 
+            // Tune the new connection before the first data is exchanged (Keep it with default options if tuning fails)
+            if (!applyConnectionSocketOptions(newConnection, socketOptions))
+            {
+#ifdef DEVELOP
+                ::std::cerr << DEBUGINFO << ": Error when setting TCP socket options of client " << newConnection << ::std::endl;
+#endif // DEVELOP
+            }
+
             // Initialize the (so far unencrypted) connection
+            ::std::shared_ptr<ConnectionInfo> info{::std::make_shared<ConnectionInfo>()};
+            info->acceptedAt = ::std::chrono::system_clock::now();
             SocketType *connection_p{connectionInit(newConnection)};
             if (!connection_p)
                 continue;
+            info->establishedAt = ::std::chrono::system_clock::now();
+
+            // Capture connection metadata once, so it never needs to be read from the socket again
+            char ip[INET_ADDRSTRLEN]{0};
+            inet_ntop(AF_INET, &peerAddress.sin_addr, ip, sizeof(ip));
+            info->ip = ip;
+            info->port = ntohs(peerAddress.sin_port);
+            readConnectionInfo(connection_p, *info);
 
             // Add connection to active connections
             {
                 ::std::lock_guard<::std::mutex> lck{activeConnections_m};
                 activeConnections[newConnection] = ::std::unique_ptr<SocketType, SocketDeleter>{connection_p};
+                connectionInfos[newConnection] = ::std::move(info);
+                readPauses[newConnection] = ::std::make_shared<ReadPause>();
+                publishClients();
             }
 
             // When a new connection is established, the incoming messages of this connection should be read in a new process
@@ -608,6 +1464,9 @@ namespace tcp
             {
                 shutdown(it.first, SHUT_RD);
 
+                // Don't let a paused receive thread wait forever
+                readPauses[it.first]->close();
+
 #ifdef DEVELOP
                 ::std::cout << DEBUGINFO << ": Closed connection to client " << it.first << ::std::endl;
 #endif // DEVELOP
@@ -615,48 +1474,104 @@ namespace tcp
         }
 
         // Wait for all receive processes to finish
+        // Forget them, so a restarted server doesn't join them again
         for (auto &it : recHandlers)
             it.second.join();
+        recHandlers.clear();
+        recHandlersRunning.clear();
 
         return;
     }
 
-    template <class SocketType, class SocketDeleter>
-    void Server<SocketType, SocketDeleter>::listenMessage(const int clientId, RunningFlag *const recRunning_p)
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::listenMessage(const int clientId, RunningFlag *const recRunning_p)
     {
         // Mark Thread as running (Add running flag and connect to handler)
         Server_running_manager running_mgr{*recRunning_p};
 
-        // Get connection from map
+        // Get connection and its read pause state from map
         SocketType *connection_p;
+        ::std::shared_ptr<ReadPause> readPause;
         {
             ::std::lock_guard<::std::mutex> lck{activeConnections_m};
             if (activeConnections.find(clientId) == activeConnections.end())
                 return;
             connection_p = activeConnections[clientId].get();
+            readPause = readPauses[clientId];
         }
 
-        // Create continuous stream for this connection
-        if (generateNewForwardStream)
-            forwardStreams[clientId] = ::std::unique_ptr<::std::ostream>{generateNewForwardStream(clientId)};
+        // Create continuous stream for this connection (Owned by this receive thread)
+        ::std::unique_ptr<::std::ostream> forwardStream{handler.createForwardStream(clientId)};
+
+        // Create splice target for this connection (Continuous mode on unencrypted connections only)
+        const int spliceTarget{!framing.enabled() && createSpliceTarget && spliceSupported() ? createSpliceTarget(clientId) : -1};
+        ::std::unique_ptr<SpliceForwarder> spliceForwarder{0 <= spliceTarget ? new SpliceForwarder{clientId, spliceTarget, DEFAULT_SPLICE_CHUNK_SIZE, splicedBytes, copiedBytes} : nullptr};
 
         // Run worker for new established connections
-        if (workOnEstablished)
-            workOnEstablished(clientId);
+        // The user context lives in this receive thread as long as the connection does
+        void *const userContext{handler.established(clientId)};
 
-        // Vectors of running work handlers and their status flags
+        // Vectors of running work handlers and their status flags (Not used if workers run in this thread)
+        const bool inlineWork{inlineMessageWork};
         ::std::vector<::std::thread> workHandlers;
         ::std::vector<::std::unique_ptr<RunningFlag>> workHandlersRunning;
 
+        // Pin this receive thread before its buffers are allocated, so their pages are placed on its NUMA node
+        // A spinning receive thread stays on the CPUs of the busy poll policy, otherwise it follows the incoming data if enabled
+        const bool busyPoll{busyPollEnabled};
+        const int incoming{threadAffinity.followIncomingCpu ? incomingCpu(clientId) : -1};
+        if (busyPoll && !busyPollPolicy.cpus.empty())
+            pinCurrentThread(busyPollPolicy.cpus);
+        else if (0 <= incoming)
+            pinCurrentThread({incoming});
+        else
+            pinCurrentThread(threadAffinity.io);
+
+        // CPUs of the workers of this connection (NUMA node of the incoming data if followed)
+        const ::std::vector<int> workerCpus{0 <= incoming ? cpusOfNode(nodeOfCpu(incoming)) : threadAffinity.workers};
+
+        // Receive buffer reused for all reads on this connection (Not zeroed, only the read bytes are used)
+        BufferPool &connectionPool{threadAffinity.numaLocalBuffers ? localBufferPool() : bufferPool};
+        ReceiveBuffer receiveBuffer{receiveChunkSizeMin, receiveChunkSizeMax, &connectionPool};
+
         // Read incoming messages from this connection as long as the connection is active
-        ::std::string buffer;
+        // If a message exceeds the maximum length, its remaining data is skipped until the next delimiter
+        MessageType buffer;
+        bool skipOversized{false};
+
+        // State of the message currently streamed (Only used if messages are streamed)
+        MessageStreamState streamState;
+
+        // Raw data collected for the data worker (Only used in continuous mode with a batch size)
+        const size_t batchSize{dataBatchSize};
+        ::std::pmr::vector<char> dataBatch{&connectionPool};
+
+        // Renew quick ack mode after each read if enabled
+        const bool quickAck{socketOptions.quickAck};
+
+        // Let the kernel busy poll the socket as well
+        const ::std::chrono::microseconds busyPollBudget{busyPollPolicy.budget};
+        if (busyPoll)
+            enableSocketBusyPoll(clientId, busyPollBudget);
         while (1)
         {
-            // Wait for new incoming message (implemented in derived classes)
-            // If message is empty string, the connection is broken
+            // Don't read while reading is paused, so the kernel receive window throttles the client
+            readPause->waitWhilePaused();
+
+            // Spin for incoming data before blocking in the read (Unless data is buffered by the connection already)
+            if (busyPoll && !pendingData(connection_p))
+                spinUntilReadable(clientId, busyPollBudget);
+
+            // Wait for new incoming data (implemented in derived classes) or forward it to the splice target directly
+            // If no data is read, the connection is broken
             // BUG: Execution stucks here if server is stopped immediately after client connection
-            ::std::string msg{readMsg(connection_p)};
-            if (msg.empty())
+            const ssize_t lenMsg{spliceForwarder ? spliceForwarder->forward() : readMsg(connection_p, receiveBuffer.data(), receiveBuffer.size())};
+
+            // The kernel leaves quick ack mode on its own, so renew it after each read
+            if (quickAck && 0 < lenMsg)
+                setIntSocketOption(clientId, IPPROTO_TCP, TCP_QUICKACK, 1);
+
+            if (0 >= lenMsg)
             {
 #ifdef DEVELOP
                 ::std::cout << DEBUGINFO << ": Connection to client " << clientId << " broken" << ::std::endl;
@@ -673,12 +1588,12 @@ namespace tcp
 
                     // Remove connection from active connections
                     activeConnections.erase(clientId);
+                    connectionInfos.erase(clientId);
+                    readPauses.erase(clientId);
+                    sendBatches.erase(clientId);
+                    publishClients();
                 }
 
-                // Run code to handle the closed connection
-                if (workOnClosed)
-                    workOnClosed(clientId);
-
                 // Close the connection
                 close(clientId);
 
@@ -686,52 +1601,102 @@ namespace tcp
                 for (auto &it : workHandlers)
                     it.join();
 
-                // Remove continuous stream
-                if (forwardStreams.find(clientId) != forwardStreams.end())
-                    forwardStreams.erase(clientId);
+                // Abort a message streamed at the moment
+                streamMessageEnd(clientId, streamState, false);
+
+                // Close splice target
+                if (0 <= spliceTarget)
+                    close(spliceTarget);
+
+                // Pass remaining collected data
+                if (!dataBatch.empty())
+                    workOnData(clientId, dataBatch.data(), dataBatch.size());
+
+                // Run code to handle the closed connection (After all message workers using the user context are finished)
+                handler.closed(clientId, userContext);
 
                 return;
             }
 
+            // Data is already forwarded to the splice target
+            if (spliceForwarder)
+                continue;
+
+            // If stream shall be fragmented and messages shall be streamed ...
+            if (framing.enabled() && workOnMessageChunk)
+            {
+                // Pass all message parts to the streaming workers directly from the receive buffer
+                const char *msg_begin{receiveBuffer.data()};
+                const char *const msg_end{msg_begin + lenMsg};
+                const char *delimiter_pos{static_cast<const char *>(memchr(msg_begin, framing.delimiter(), msg_end - msg_begin))};
+                while (delimiter_pos)
+                {
+                    streamMessagePart(clientId, msg_begin, delimiter_pos - msg_begin, streamState);
+                    streamMessageEnd(clientId, streamState, true);
+                    msg_begin = delimiter_pos + 1;
+                    delimiter_pos = static_cast<const char *>(memchr(msg_begin, framing.delimiter(), msg_end - msg_begin));
+                }
+                streamMessagePart(clientId, msg_begin, msg_end - msg_begin, streamState);
+            }
+
             // If stream shall be fragmented ...
-            if (MESSAGE_FRAGMENTATION_ENABLED)
+            else if (framing.enabled())
             {
-                // Get raw message separated by delimiter
-                // If delimiter is found, the message is split into two parts
-                size_t delimiter_pos{msg.find(DELIMITER_FOR_FRAGMENTATION)};
-                while (::std::string::npos != delimiter_pos)
+                // Get raw message parts separated by delimiter directly from the receive buffer
+                // Each complete part is appended to the message buffer without creating temporary strings
+                const char *msg_begin{receiveBuffer.data()};
+                const char *const msg_end{msg_begin + lenMsg};
+                const char *delimiter_pos{static_cast<const char *>(memchr(msg_begin, framing.delimiter(), msg_end - msg_begin))};
+                while (delimiter_pos)
                 {
-                    ::std::string msg_part{msg.substr(0, delimiter_pos)};
-                    msg = msg.substr(delimiter_pos + 1);
-                    delimiter_pos = msg.find(DELIMITER_FOR_FRAGMENTATION);
+                    const char *const msg_part{msg_begin};
+                    const size_t msg_part_len{static_cast<size_t>(delimiter_pos - msg_begin)};
+                    msg_begin = delimiter_pos + 1;
+                    delimiter_pos = static_cast<const char *>(memchr(msg_begin, framing.delimiter(), msg_end - msg_begin));
 
-                    // Check if the message is too long
-                    if (buffer.size() + msg_part.size() > MAXIMUM_MESSAGE_LENGTH_FOR_FRAGMENTATION)
+                    // Drop the message if it is too long (Already reported if the rest of it was skipped)
+                    if (skipOversized || buffer.size() + msg_part_len > framing.maxLength())
                     {
-#ifdef DEVELOP
-                        ::std::cerr << DEBUGINFO << ": Message from client " << clientId << " is too long" << ::std::endl;
-#endif // DEVELOP
-
+                        if (!skipOversized)
+                            reportOversizedMessage(clientId);
+                        skipOversized = false;
                         buffer.clear();
                         continue;
                     }
 
-                    buffer += msg_part;
+                    // Drop the message if it could not be stored
+                    if (!appendMessagePart(clientId, buffer, msg_part, msg_part_len))
+                    {
+                        buffer.clear();
+                        continue;
+                    }
 
 #ifdef DEVELOP
-                    ::std::cout << DEBUGINFO << ": Message from client " << clientId << ": " << buffer << ::std::endl;
+                    ::std::cout << DEBUGINFO << ": Message from client " << clientId << ": " << buffer.view() << ::std::endl;
 #endif // DEVELOP
 
-                    // Run code to handle the message
+                    // Run code to handle the request or message directly in this thread
+                    if (inlineWork)
+                    {
+                        if (!handleRequest(clientId, buffer))
+                            handler.message(clientId, userContext, ::std::move(buffer));
+                        buffer.clear();
+                        continue;
+                    }
+
+                    // Run code to handle the message in a new thread
                     ::std::unique_ptr<RunningFlag> workRunning{new RunningFlag{true}};
-                    ::std::thread work_t{[this, clientId](RunningFlag *const workRunning_p, ::std::string buffer)
+                    ::std::thread work_t{[this, clientId, userContext, &workerCpus](RunningFlag *const workRunning_p, MessageType buffer)
                                          {
                                              // Mark Thread as running
                                              Server_running_manager running_mgr{*workRunning_p};
 
-                                             // Run code to handle the incoming message
-                                             if (workOnMessage)
-                                                 workOnMessage(clientId, ::std::move(buffer));
+                                             // Keep the worker on its CPUs
+                                             pinCurrentThread(workerCpus);
+
+                                             // Run code to handle the incoming request or message
+                                             if (!handleRequest(clientId, buffer))
+                                                 handler.message(clientId, userContext, ::std::move(buffer));
 
                                              return;
                                          },
@@ -754,24 +1719,186 @@ namespace tcp
                     workHandlers.push_back(::std::move(work_t));
                     workHandlersRunning.push_back(::std::move(workRunning));
                 }
-                buffer += msg;
+
+                // Keep the incomplete rest of the message only if it doesn't exceed the maximum length yet
+                // Otherwise skip all data until the next delimiter without storing it
+                if (!skipOversized)
+                {
+                    if (buffer.size() + (msg_end - msg_begin) > framing.maxLength())
+                    {
+                        reportOversizedMessage(clientId);
+                        skipOversized = true;
+                        buffer.clear();
+                    }
+                    else if (!appendMessagePart(clientId, buffer, msg_begin, msg_end - msg_begin))
+                    {
+                        skipOversized = true;
+                        buffer.clear();
+                    }
+                }
+            }
+
+            // If stream shall be passed to the data worker ...
+            else if (workOnData)
+            {
+                // A read not filling the receive buffer means no more data is waiting
+                const bool drained{static_cast<size_t>(lenMsg) < receiveBuffer.size()};
+
+                // Pass data directly from the receive buffer if nothing is collected and the read is large enough or the last one for now
+                if (dataBatch.empty() && (drained || static_cast<size_t>(lenMsg) >= batchSize))
+                    workOnData(clientId, receiveBuffer.data(), lenMsg);
+
+                // Otherwise collect data until the batch is full or no more data is waiting
+                else
+                {
+                    dataBatch.insert(dataBatch.end(), receiveBuffer.data(), receiveBuffer.data() + lenMsg);
+                    if (drained || dataBatch.size() >= batchSize)
+                    {
+                        workOnData(clientId, dataBatch.data(), dataBatch.size());
+                        dataBatch.clear();
+                    }
+                }
             }
 
             // If stream shall be forwarded to continuous out stream ...
             else
             {
                 // Just forward incoming message to output stream
-                if (forwardStreams.find(clientId) != forwardStreams.end())
-                    *forwardStreams[clientId].get() << msg << ::std::flush;
+                if (forwardStream)
+                    forwardStream->write(receiveBuffer.data(), lenMsg).flush();
             }
+
+            // Adapt receive buffer size to the last read
+            receiveBuffer.update(lenMsg);
         }
     }
 
-    template <class SocketType, class SocketDeleter>
-    bool Server<SocketType, SocketDeleter>::isRunning() const
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    bool Server<SocketType, SocketDeleter, Handler, Framing>::isRunning() const
     {
         return running;
     }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::reportOversizedMessage(const int clientId)
+    {
+#ifdef DEVELOP
+        ::std::cerr << DEBUGINFO << ": Message from client " << clientId << " is too long" << ::std::endl;
+#endif // DEVELOP
+
+        oversizedMessages.fetch_add(1, ::std::memory_order_relaxed);
+        if (workOnOversizedMessage)
+            workOnOversizedMessage(clientId);
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    bool Server<SocketType, SocketDeleter, Handler, Framing>::handleRequest(const int clientId, MessageType &buffer)
+    {
+        // Messages without correlation header are no requests
+        uint64_t requestId;
+        ::std::string_view payload;
+        if (!workOnRequest || !decodeCorrelated(buffer.view(), requestId, payload))
+            return false;
+
+        workOnRequest(clientId, requestId, ::std::string{payload});
+        return true;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    BufferPool &Server<SocketType, SocketDeleter, Handler, Framing>::localBufferPool()
+    {
+        const int node{currentNode()};
+        ::std::lock_guard<::std::mutex> lck{nodeBufferPools_m};
+        ::std::unique_ptr<BufferPool> &pool{nodeBufferPools[node]};
+        if (!pool)
+            pool.reset(new BufferPool{bufferUpstream});
+        return *pool;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    bool Server<SocketType, SocketDeleter, Handler, Framing>::appendMessagePart([[maybe_unused]] const int clientId, MessageType &buffer, const char *part, const size_t len)
+    {
+        // Spill the message to disk if it gets too large to keep it in memory
+        if (0 < spillThreshold && !buffer.isSpilled() && buffer.size() + len > spillThreshold)
+        {
+            if (!buffer.spill(spillDirectory))
+            {
+#ifdef DEVELOP
+                ::std::cerr << DEBUGINFO << ": Unable to spill message from client " << clientId << " to " << spillDirectory << ": " << strerror(errno) << ::std::endl;
+#endif // DEVELOP
+
+                return false;
+            }
+        }
+
+        if (!buffer.append(part, len))
+        {
+#ifdef DEVELOP
+            ::std::cerr << DEBUGINFO << ": Unable to write message from client " << clientId << " to spill file: " << strerror(errno) << ::std::endl;
+#endif // DEVELOP
+
+            return false;
+        }
+        return true;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::streamMessagePart(const int clientId, const char *part, const size_t len, MessageStreamState &state)
+    {
+        // Nothing to pass if the rest of the message is skipped
+        if (state.skipping || 0 == len)
+            return;
+
+        // Begin a new message
+        if (!state.inMessage)
+        {
+            if (workOnMessageBegin)
+                workOnMessageBegin(clientId);
+            state.inMessage = true;
+            state.length = 0;
+        }
+
+        // Drop the message if it gets too long and skip its rest until the next delimiter
+        if (state.length + len > framing.maxLength())
+        {
+            reportOversizedMessage(clientId);
+            if (workOnMessageEnd)
+                workOnMessageEnd(clientId, false);
+            state.inMessage = false;
+            state.skipping = true;
+            return;
+        }
+
+        workOnMessageChunk(clientId, part, len);
+        state.length += len;
+        return;
+    }
+
+    template <class SocketType, class SocketDeleter, class Handler, class Framing>
+    void Server<SocketType, SocketDeleter, Handler, Framing>::streamMessageEnd(const int clientId, MessageStreamState &state, const bool complete)
+    {
+        // A dropped message is already ended
+        if (state.skipping)
+        {
+            state.skipping = !complete;
+            return;
+        }
+
+        // On closed connection, only a begun message needs to be aborted
+        if (!complete && !state.inMessage)
+            return;
+
+        // Begin empty messages before ending them
+        if (!state.inMessage && workOnMessageBegin)
+            workOnMessageBegin(clientId);
+
+        if (workOnMessageEnd)
+            workOnMessageEnd(clientId, complete);
+        state.inMessage = false;
+        state.length = 0;
+        return;
+    }
 }
 
 #endif // SERVER_HPP_
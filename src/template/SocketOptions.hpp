@@ -0,0 +1,90 @@
+/**
+ * @file SocketOptions.hpp
+ * @author Nils Henrich
+ * @brief Tuning of TCP sockets for latency and failure detection.
+ * @version 3.2.1
+ * @date 2025-02-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef SOCKETOPTIONS_HPP_
+#define SOCKETOPTIONS_HPP_
+
+#include <chrono>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+namespace tcp
+{
+    /**
+     * @brief Options set on the sockets of a server or client (0 = System default)
+     */
+    struct SocketOptions
+    {
+        bool reuseAddress{true};                     // Allow binding to a port with connections in TIME_WAIT (SO_REUSEADDR)
+        bool noDelay{false};                         // Send small messages right away instead of collecting them (TCP_NODELAY)
+        bool quickAck{false};                        // Acknowledge incoming data right away instead of delaying (TCP_QUICKACK, renewed after each read)
+        int sendBufferSize{0};                       // Kernel send buffer size in bytes (SO_SNDBUF)
+        int receiveBufferSize{0};                    // Kernel receive buffer size in bytes (SO_RCVBUF)
+        bool keepAlive{false};                       // Probe idle connections to detect dead peers (SO_KEEPALIVE)
+        ::std::chrono::seconds keepAliveIdle{0};     // Idle time before the first probe (TCP_KEEPIDLE)
+        ::std::chrono::seconds keepAliveInterval{0}; // Time between probes (TCP_KEEPINTVL)
+        int keepAliveCount{0};                       // Unanswered probes until the connection is dropped (TCP_KEEPCNT)
+        ::std::chrono::milliseconds userTimeout{0};  // Maximum time sent data may stay unacknowledged (TCP_USER_TIMEOUT)
+        int backlog{SOMAXCONN};                      // Maximum number of connections waiting to be accepted (Server only)
+    };
+
+    /**
+     * @brief Set an integer socket option
+     *
+     * @param fd
+     * @param level
+     * @param name
+     * @param value
+     * @return bool
+     */
+    inline bool setIntSocketOption(const int fd, const int level, const int name, const int value)
+    {
+        return 0 == setsockopt(fd, level, name, &value, sizeof(value));
+    }
+
+    /**
+     * @brief Set the options of a listening socket (Before bind and listen).
+     * The buffer sizes are set here already, so the window scaling of accepted connections fits them.
+     *
+     * @param fd
+     * @param options
+     * @return bool (false if an option could not be set)
+     */
+    inline bool applyListenSocketOptions(const int fd, const SocketOptions &options)
+    {
+        return setIntSocketOption(fd, SOL_SOCKET, SO_REUSEADDR, options.reuseAddress ? 1 : 0) &&
+               (0 == options.sendBufferSize || setIntSocketOption(fd, SOL_SOCKET, SO_SNDBUF, options.sendBufferSize)) &&
+               (0 == options.receiveBufferSize || setIntSocketOption(fd, SOL_SOCKET, SO_RCVBUF, options.receiveBufferSize));
+    }
+
+    /**
+     * @brief Set the options of a connection socket (Accepted or before connect)
+     *
+     * @param fd
+     * @param options
+     * @return bool (false if an option could not be set)
+     */
+    inline bool applyConnectionSocketOptions(const int fd, const SocketOptions &options)
+    {
+        return (!options.noDelay || setIntSocketOption(fd, IPPROTO_TCP, TCP_NODELAY, 1)) &&
+               (!options.quickAck || setIntSocketOption(fd, IPPROTO_TCP, TCP_QUICKACK, 1)) &&
+               (0 == options.sendBufferSize || setIntSocketOption(fd, SOL_SOCKET, SO_SNDBUF, options.sendBufferSize)) &&
+               (0 == options.receiveBufferSize || setIntSocketOption(fd, SOL_SOCKET, SO_RCVBUF, options.receiveBufferSize)) &&
+               (!options.keepAlive || setIntSocketOption(fd, SOL_SOCKET, SO_KEEPALIVE, 1)) &&
+               (!options.keepAlive || 0 == options.keepAliveIdle.count() || setIntSocketOption(fd, IPPROTO_TCP, TCP_KEEPIDLE, static_cast<int>(options.keepAliveIdle.count()))) &&
+               (!options.keepAlive || 0 == options.keepAliveInterval.count() || setIntSocketOption(fd, IPPROTO_TCP, TCP_KEEPINTVL, static_cast<int>(options.keepAliveInterval.count()))) &&
+               (!options.keepAlive || 0 == options.keepAliveCount || setIntSocketOption(fd, IPPROTO_TCP, TCP_KEEPCNT, options.keepAliveCount)) &&
+               (0 == options.userTimeout.count() || setIntSocketOption(fd, IPPROTO_TCP, TCP_USER_TIMEOUT, static_cast<int>(options.userTimeout.count())));
+    }
+}
+
+#endif // SOCKETOPTIONS_HPP_
@@ -0,0 +1,208 @@
+/**
+ * @file SpliceForwarder.hpp
+ * @author Nils Henrich
+ * @brief Forwarding of incoming data from a socket to a file descriptor with splice(2).
+ * The data is moved through a pipe inside the kernel and never copied to user space.
+ * If splicing is not supported by the socket or the target, the data is copied with read and write instead.
+ * @version 3.2.1
+ * @date 2025-02-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef SPLICEFORWARDER_HPP_
+#define SPLICEFORWARDER_HPP_
+
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace tcp
+{
+    // Default number of bytes per forwarding step (Default pipe capacity)
+    constexpr size_t DEFAULT_SPLICE_CHUNK_SIZE{65536};
+
+    /**
+     * @brief Counters of forwarding to splice targets
+     */
+    struct SpliceStats
+    {
+        uint64_t splicedBytes{0}; // Bytes moved inside the kernel with splice
+        uint64_t copiedBytes{0};  // Bytes copied with read and write because splicing was not supported
+    };
+
+    /**
+     * @brief Forward data of one connection from the socket to a target file descriptor.
+     * Splicing is used as long as it works. After the first failure caused by an unsupported socket or target,
+     * this connection falls back to read and write for good.
+     */
+    class SpliceForwarder
+    {
+    public:
+        /**
+         * @brief Constructor (Create the pipe to splice through)
+         *
+         * @param sourceFd      Socket to read from
+         * @param targetFd      File descriptor to forward to
+         * @param chunkSize     Maximum number of bytes per forwarding step
+         * @param splicedBytes  Counter for bytes moved with splice
+         * @param copiedBytes   Counter for bytes copied with read and write
+         */
+        SpliceForwarder(int sourceFd, int targetFd, size_t chunkSize, ::std::atomic<uint64_t> &splicedBytes, ::std::atomic<uint64_t> &copiedBytes) : SOURCE_FD{sourceFd},
+                                                                                                                                                   TARGET_FD{targetFd},
+                                                                                                                                                   CHUNK_SIZE{chunkSize},
+                                                                                                                                                   splicedBytes{splicedBytes},
+                                                                                                                                                   copiedBytes{copiedBytes}
+        {
+            // Without pipe, splicing is not possible
+            if (pipe2(pipeFds, O_CLOEXEC))
+            {
+                pipeFds[0] = -1;
+                pipeFds[1] = -1;
+                useSplice = false;
+            }
+        }
+
+        /**
+         * @brief Destructor (Close the pipe)
+         */
+        virtual ~SpliceForwarder()
+        {
+            if (0 <= pipeFds[0])
+                close(pipeFds[0]);
+            if (0 <= pipeFds[1])
+                close(pipeFds[1]);
+        }
+
+        /**
+         * @brief Wait for incoming data on the socket and forward it to the target.
+         * Blocks until data is available.
+         *
+         * @return ssize_t (Number of bytes forwarded, 0 if the connection is closed, -1 on error)
+         */
+        ssize_t forward()
+        {
+            if (useSplice)
+            {
+                // Move incoming data from socket into the pipe
+                ssize_t lenIn;
+                do
+                    lenIn = splice(SOURCE_FD, nullptr, pipeFds[1], nullptr, CHUNK_SIZE, SPLICE_F_MOVE | SPLICE_F_MORE);
+                while (0 > lenIn && EINTR == errno);
+                if (0 <= lenIn)
+                    return 0 == lenIn ? 0 : drainPipe(lenIn);
+
+                // Socket doesn't support splicing: Copy from now on
+                if (EINVAL != errno && ENOSYS != errno)
+                    return -1;
+                useSplice = false;
+            }
+
+            // Copy incoming data through user space
+            buffer.resize(CHUNK_SIZE);
+            const ssize_t lenIn{read(SOURCE_FD, buffer.data(), buffer.size())};
+            if (0 >= lenIn)
+                return lenIn;
+            if (!writeTarget(buffer.data(), lenIn))
+                return -1;
+            copiedBytes.fetch_add(lenIn, ::std::memory_order_relaxed);
+            return lenIn;
+        }
+
+    private:
+        /**
+         * @brief Move all data from the pipe to the target (Copy it if the target doesn't support splicing)
+         *
+         * @param len   Number of bytes in the pipe
+         * @return ssize_t (len on success, -1 on error)
+         */
+        ssize_t drainPipe(const size_t len)
+        {
+            size_t lenLeft{len};
+            while (0 < lenLeft && useSplice)
+            {
+                const ssize_t lenOut{splice(pipeFds[0], nullptr, TARGET_FD, nullptr, lenLeft, SPLICE_F_MOVE | SPLICE_F_MORE)};
+                if (0 < lenOut)
+                {
+                    splicedBytes.fetch_add(lenOut, ::std::memory_order_relaxed);
+                    lenLeft -= lenOut;
+                    continue;
+                }
+                if (0 > lenOut && EINTR == errno)
+                    continue;
+
+                // Target doesn't support splicing (e.g. opened with O_APPEND): Copy from now on
+                if (0 > lenOut && (EINVAL == errno || ENOSYS == errno))
+                {
+                    useSplice = false;
+                    break;
+                }
+                return -1;
+            }
+
+            // Copy the rest left in the pipe
+            buffer.resize(CHUNK_SIZE);
+            while (0 < lenLeft)
+            {
+                const ssize_t lenRead{read(pipeFds[0], buffer.data(), lenLeft < buffer.size() ? lenLeft : buffer.size())};
+                if (0 >= lenRead || !writeTarget(buffer.data(), lenRead))
+                    return -1;
+                copiedBytes.fetch_add(lenRead, ::std::memory_order_relaxed);
+                lenLeft -= lenRead;
+            }
+            return len;
+        }
+
+        /**
+         * @brief Write data to the target completely
+         *
+         * @param data
+         * @param len
+         * @return bool
+         */
+        bool writeTarget(const char *data, size_t len)
+        {
+            while (0 < len)
+            {
+                const ssize_t lenWritten{write(TARGET_FD, data, len)};
+                if (0 > lenWritten && EINTR == errno)
+                    continue;
+                if (0 >= lenWritten)
+                    return false;
+                data += lenWritten;
+                len -= lenWritten;
+            }
+            return true;
+        }
+
+        // Socket to read from and file descriptor to forward to
+        const int SOURCE_FD;
+        const int TARGET_FD;
+
+        // Maximum number of bytes per forwarding step
+        const size_t CHUNK_SIZE;
+
+        // Pipe to splice through (Read end, write end)
+        int pipeFds[2]{-1, -1};
+
+        // Splicing is used until it fails for being not supported
+        bool useSplice{true};
+
+        // Buffer for copying (Only allocated if splicing is not supported)
+        ::std::vector<char> buffer;
+
+        // Counters
+        ::std::atomic<uint64_t> &splicedBytes;
+        ::std::atomic<uint64_t> &copiedBytes;
+
+        // Disallow copy
+        SpliceForwarder(const SpliceForwarder &) = delete;
+        SpliceForwarder &operator=(const SpliceForwarder &) = delete;
+    };
+}
+
+#endif // SPLICEFORWARDER_HPP_
@@ -0,0 +1,60 @@
+#ifndef BENCHMARK_HELPERS_H_
+#define BENCHMARK_HELPERS_H_
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+namespace BenchmarkHelpers
+{
+    /**
+     * @brief Run a function repeatedly and return the average runtime per run in nanoseconds
+     *
+     * @param iterations    Number of runs
+     * @param fn            Function to run (Gets the iteration index)
+     * @return double
+     */
+    template <class Fn>
+    double measureNsPerOp(const uint64_t iterations, Fn &&fn)
+    {
+        const auto start{::std::chrono::steady_clock::now()};
+        for (uint64_t i{0}; i < iterations; i += 1)
+            fn(i);
+        const auto end{::std::chrono::steady_clock::now()};
+        return static_cast<double>(::std::chrono::duration_cast<::std::chrono::nanoseconds>(end - start).count()) / iterations;
+    }
+
+    /**
+     * @brief Print a single result line
+     *
+     * @param name  Name of the measured variant
+     * @param value Measured value
+     * @param unit  Unit of the measured value
+     */
+    inline void printResult(const ::std::string &name, const double value, const ::std::string &unit)
+    {
+        ::std::cout << ::std::left << ::std::setw(48) << name << ::std::right << ::std::setw(12) << ::std::fixed << ::std::setprecision(2) << value << " " << unit << ::std::endl;
+    }
+
+    /**
+     * @brief Get a percentile of samples (Sorts the samples)
+     *
+     * @param samples
+     * @param percentile    Percentile between 0 and 100
+     * @return double
+     */
+    inline double percentile(::std::vector<double> &samples, const double percentile)
+    {
+        if (samples.empty())
+            return 0.0;
+        ::std::sort(samples.begin(), samples.end());
+        const size_t index{static_cast<size_t>(percentile / 100.0 * (samples.size() - 1) + 0.5)};
+        return samples[index];
+    }
+} // namespace BenchmarkHelpers
+
+#endif // BENCHMARK_HELPERS_H_
@@ -0,0 +1,75 @@
+// Microbenchmark: Passing received data to a consumer in continuous mode
+// Compares the forward stream (std::ostream::write and flush per read, as done by the receive loop)
+// with the data worker (std::function called with the raw bytes) for small and large reads.
+// The consumer only counts the bytes, so the measured time is the overhead of the forwarding itself.
+
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <streambuf>
+#include <string>
+
+#include "BenchmarkHelpers.h"
+
+using namespace std;
+
+namespace
+{
+    // Number of reads per run
+    const uint64_t ITERATIONS{20000000};
+
+    // Sink for received data, so the work is not optimized away
+    volatile size_t sink{0};
+
+    // Stream buffer passing all data to the consumer without buffering (Like a parser implemented as stream)
+    class CountingBuffer : public streambuf
+    {
+    protected:
+        streamsize xsputn(const char *, streamsize len) override
+        {
+            sink = sink + len;
+            return len;
+        }
+        int_type overflow(int_type ch) override
+        {
+            sink = sink + 1;
+            return ch;
+        }
+        int sync() override { return 0; }
+    };
+
+    /**
+     * @brief Run all variants on one read size and print the results
+     *
+     * @param name
+     * @param readSize
+     */
+    void run(const string &name, const size_t readSize)
+    {
+        const string data(readSize, 'x');
+
+        // Forward stream
+        CountingBuffer buffer;
+        ostream forwardStream{&buffer};
+
+        // Data worker
+        function<void(const int, const char *, const size_t)> workOnData{[](const int clientId, const char *, const size_t len)
+                                                                         { sink = sink + len + clientId; }};
+
+        cout << name << ":" << endl;
+        BenchmarkHelpers::printResult("  Forward stream (write + flush)", BenchmarkHelpers::measureNsPerOp(ITERATIONS, [&](const uint64_t)
+                                                                                                            { forwardStream.write(data.data(), data.size()).flush(); }),
+                                      "ns/read");
+        BenchmarkHelpers::printResult("  Data worker", BenchmarkHelpers::measureNsPerOp(ITERATIONS, [&](const uint64_t)
+                                                                                         { workOnData(0, data.data(), data.size()); }),
+                                      "ns/read");
+        return;
+    }
+}
+
+int main()
+{
+    run("Small reads (64 bytes)", 64);
+    run("Large reads (16 KB)", 16384);
+    return 0;
+}
@@ -0,0 +1,77 @@
+// Microbenchmark: Per-message dispatch overhead of the server handler policy
+// Compares the default ServerCallbacks (std::function workers, optionally bound via std::bind)
+// with a custom handler policy that the compiler can call directly and inline.
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include "TcpServer.hpp"
+#include "BenchmarkHelpers.h"
+
+using namespace std;
+using namespace tcp;
+
+namespace
+{
+    // Number of dispatched messages per variant
+    const uint64_t ITERATIONS{50000000};
+
+    // Sink for received data, so the work is not optimized away
+    volatile size_t sink{0};
+
+    // Worker class as typically bound via std::bind
+    class Worker
+    {
+    public:
+        void workOnMessage(const int clientId, const string msg) { sink = sink + msg.size() + clientId; }
+    };
+
+    // Custom handler policy with the same work as the worker above
+    class InlineHandler
+    {
+    public:
+        ostream *createForwardStream(const int) { return nullptr; }
+        void *established(const int) { return nullptr; }
+        void message(const int clientId, void *, Message msg) { sink = sink + msg.size() + clientId; }
+        void closed(const int, void *) {}
+    };
+
+    // Dispatch all messages through a handler policy exactly like the server's receive path does
+    template <class Handler>
+    double dispatch(Handler &handler)
+    {
+        Message msg;
+        msg.append("short message", 13);
+        return BenchmarkHelpers::measureNsPerOp(ITERATIONS, [&handler, &msg](const uint64_t i)
+                                                { handler.message(static_cast<int>(i & 0xff), nullptr, msg); });
+    }
+}
+
+int main()
+{
+    Worker worker;
+
+    // Default handler policy with worker bound via std::bind
+    ServerCallbacks callbacksBind;
+    callbacksBind.workOnMessage = bind(&Worker::workOnMessage, &worker, placeholders::_1, placeholders::_2);
+
+    // Default handler policy with lambda worker
+    ServerCallbacks callbacksLambda;
+    callbacksLambda.workOnMessage = [](const int clientId, const string msg)
+    { sink = sink + msg.size() + clientId; };
+
+    // Custom handler policy
+    InlineHandler inlineHandler;
+
+    // Compile-time check: Custom handler policy is accepted by the server
+    BasicTcpServer<InlineHandler> server{'\n'};
+    (void)server.getHandler();
+
+    // Run benchmarks
+    BenchmarkHelpers::printResult("ServerCallbacks (std::function + std::bind)", dispatch(callbacksBind), "ns/msg");
+    BenchmarkHelpers::printResult("ServerCallbacks (std::function + lambda)", dispatch(callbacksLambda), "ns/msg");
+    BenchmarkHelpers::printResult("Custom handler policy (inlined)", dispatch(inlineHandler), "ns/msg");
+
+    return 0;
+}
@@ -0,0 +1,155 @@
+// Microbenchmark: Heap allocations per message on the fragmentation receive path
+// Reassembles a stream of delimited messages from 16 KB receive chunks and hands each message to a handler,
+// like the receive loop of the server does.
+// Compares a std::string reassembly buffer (as used before the inline message storage) with the Message type,
+// once with the default ServerCallbacks (std::function worker taking a string) and once with a custom handler policy.
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "TcpServer.hpp"
+#include "BenchmarkHelpers.h"
+
+using namespace std;
+using namespace tcp;
+
+// Count all heap allocations of this program
+namespace
+{
+    atomic<uint64_t> allocations{0};
+}
+
+void *operator new(size_t size)
+{
+    allocations.fetch_add(1, memory_order_relaxed);
+    if (void *p = malloc(size ? size : 1))
+        return p;
+    throw bad_alloc{};
+}
+
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+namespace
+{
+    // Number of messages per run and size of a receive chunk
+    const size_t MESSAGES{2000000};
+    const size_t CHUNK_SIZE{DEFAULT_RECEIVE_CHUNK_SIZE};
+
+    // Sink for received data, so the work is not optimized away
+    volatile size_t sink{0};
+
+    // Custom handler policy working on the message without converting it
+    class ViewHandler
+    {
+    public:
+        void message(const int clientId, void *, Message msg) { sink = sink + msg.view().size() + clientId; }
+    };
+
+    // Handler receiving a string, as the workers did before the inline message storage
+    class StringHandler
+    {
+    public:
+        void message(const int clientId, void *, string msg) { workOnMessage(clientId, ::std::move(msg)); }
+        function<void(const int, const string)> workOnMessage;
+    };
+
+    /**
+     * @brief Create a stream of newline delimited messages with sizes drawn from a distribution
+     *
+     * @param sizes     Possible message sizes
+     * @param weights   Weight of each size
+     * @return string
+     */
+    string createStream(const vector<size_t> &sizes, const vector<double> &weights)
+    {
+        mt19937 random{42};
+        discrete_distribution<size_t> pick{weights.begin(), weights.end()};
+        string stream;
+        for (size_t i{0}; i < MESSAGES; i += 1)
+        {
+            stream.append(sizes[pick(random)], 'x');
+            stream.push_back('\n');
+        }
+        return stream;
+    }
+
+    /**
+     * @brief Reassemble all messages of a stream chunk by chunk and dispatch them to a handler
+     *
+     * @param stream
+     * @param handler
+     * @return double (Allocations per message)
+     */
+    template <class Buffer, class Handler>
+    double reassemble(const string &stream, Handler &handler, double &nsPerMessage)
+    {
+        const uint64_t allocationsBefore{allocations.load()};
+        Buffer buffer;
+        const double nsPerChunk{BenchmarkHelpers::measureNsPerOp((stream.size() + CHUNK_SIZE - 1) / CHUNK_SIZE, [&](const uint64_t chunk)
+                                                                 {
+            const char *msg_begin{stream.data() + chunk * CHUNK_SIZE};
+            const char *const msg_end{msg_begin + min(CHUNK_SIZE, stream.size() - chunk * CHUNK_SIZE)};
+            const char *delimiter_pos{static_cast<const char *>(memchr(msg_begin, '\n', msg_end - msg_begin))};
+            while (delimiter_pos)
+            {
+                buffer.append(msg_begin, delimiter_pos - msg_begin);
+                msg_begin = delimiter_pos + 1;
+                delimiter_pos = static_cast<const char *>(memchr(msg_begin, '\n', msg_end - msg_begin));
+
+                // Hand over to the work thread by moving, then call the handler
+                Buffer handedOver{::std::move(buffer)};
+                buffer.clear();
+                handler.message(0, nullptr, ::std::move(handedOver));
+            }
+            buffer.append(msg_begin, msg_end - msg_begin); })};
+        nsPerMessage = nsPerChunk * ((stream.size() + CHUNK_SIZE - 1) / CHUNK_SIZE) / MESSAGES;
+        return static_cast<double>(allocations.load() - allocationsBefore) / MESSAGES;
+    }
+
+    /**
+     * @brief Run all variants on one message size distribution and print the results
+     *
+     * @param name
+     * @param stream
+     */
+    void run(const string &name, const string &stream)
+    {
+        // Workers and handler policies
+        StringHandler stringHandler;
+        stringHandler.workOnMessage = [](const int clientId, const string msg)
+        { sink = sink + msg.size() + clientId; };
+        ServerCallbacks callbacks;
+        callbacks.workOnMessage = [](const int clientId, const string msg)
+        { sink = sink + msg.size() + clientId; };
+        ViewHandler viewHandler;
+
+        double ns;
+        cout << name << ":" << endl;
+        BenchmarkHelpers::printResult("  std::string buffer + std::function worker", reassemble<string>(stream, stringHandler, ns), "alloc/msg");
+        BenchmarkHelpers::printResult("", ns, "ns/msg");
+        BenchmarkHelpers::printResult("  Message + ServerCallbacks (std::function)", reassemble<Message>(stream, callbacks, ns), "alloc/msg");
+        BenchmarkHelpers::printResult("", ns, "ns/msg");
+        BenchmarkHelpers::printResult("  Message + custom handler policy", reassemble<Message>(stream, viewHandler, ns), "alloc/msg");
+        BenchmarkHelpers::printResult("", ns, "ns/msg");
+        return;
+    }
+}
+
+int main()
+{
+    // Control channel: Only small messages
+    run("Small messages (8 to 64 bytes)", createStream({8, 16, 32, 48, 64}, {1, 2, 4, 2, 1}));
+
+    // Mixed traffic: Mostly small, some medium and a few large messages
+    run("Mixed messages (70% <= 64 B, 20% <= 128 B, 9% 1 KB, 1% 16 KB)", createStream({24, 64, 100, 128, 1024, 16384}, {40, 30, 10, 10, 9, 1}));
+
+    return 0;
+}
@@ -0,0 +1,185 @@
+// Benchmark: Latency from a message being sent until its worker runs, over a local TCP connection
+// Compares four ways the client receives and runs its message worker:
+//  - Thread per message (Default)
+//  - Pooled: Worker thread of a shared I/O context (setIoContext)
+//  - Inline: Receive thread itself (setInlineMessageWork)
+//  - Busy poll: Receive thread itself, spinning on the socket before blocking (setBusyPoll)
+// One-way latency: The server sends timestamped messages at a fixed interval, the client worker measures the delay.
+// Round-trip latency: The client sends a timestamped message, the server worker echoes it and the client worker measures the delay.
+// The server runs its worker in a thread per message, except for the inline and busy poll variants, where it does the same as the client.
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "TcpServer.hpp"
+#include "TcpClient.hpp"
+#include "BenchmarkHelpers.h"
+
+using namespace std;
+using namespace tcp;
+
+namespace
+{
+    // Number of messages per measurement
+    const size_t ONE_WAY_MESSAGES{20000};
+    const size_t ROUND_TRIPS{10000};
+
+    // Time between two one-way messages (So messages don't queue up, the sender sleeps to leave the CPU to the receiver)
+    const chrono::microseconds SEND_INTERVAL{50};
+
+    // First port tried for the server
+    const int FIRST_PORT{30000};
+
+    // Way the message worker is run
+    enum class Mode
+    {
+        THREAD_PER_MESSAGE,
+        POOLED,
+        INLINE,
+        BUSY_POLL,
+    };
+
+    /**
+     * @brief Get the current time in nanoseconds (Steady clock, same for server and client in one process)
+     *
+     * @return uint64_t
+     */
+    uint64_t nowNs()
+    {
+        return static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    /**
+     * @brief Latencies measured by the client worker
+     */
+    struct Samples
+    {
+        explicit Samples(const size_t count) : latencies(count) {}
+
+        // Store the latency of a received timestamp (Workers may run in parallel)
+        void add(const string &timestamp)
+        {
+            const uint64_t now{nowNs()};
+            const size_t index{next.fetch_add(1)};
+            if (index < latencies.size())
+                latencies[index] = static_cast<double>(now - stoull(timestamp)) / 1000.0;
+            done.fetch_add(1);
+        }
+
+        // Wait until a number of latencies is stored (Give up after 10 seconds)
+        bool waitFor(const size_t count) const
+        {
+            const chrono::steady_clock::time_point deadline{chrono::steady_clock::now() + chrono::seconds{10}};
+            while (done.load() < count)
+            {
+                if (chrono::steady_clock::now() > deadline)
+                    return false;
+                this_thread::yield();
+            }
+            return true;
+        }
+
+        vector<double> latencies;
+        atomic<size_t> next{0};
+        atomic<size_t> done{0};
+    };
+
+    /**
+     * @brief Print the percentiles of measured latencies
+     *
+     * @param name
+     * @param latencies
+     */
+    void printPercentiles(const string &name, vector<double> &latencies)
+    {
+        BenchmarkHelpers::printResult("  " + name + " p50", BenchmarkHelpers::percentile(latencies, 50.0), "us");
+        BenchmarkHelpers::printResult("  " + name + " p99", BenchmarkHelpers::percentile(latencies, 99.0), "us");
+        BenchmarkHelpers::printResult("  " + name + " p99.9", BenchmarkHelpers::percentile(latencies, 99.9), "us");
+        return;
+    }
+
+    /**
+     * @brief Measure and print one-way and round-trip latencies for one mode
+     *
+     * @param name
+     * @param mode
+     */
+    void run(const string &name, const Mode mode)
+    {
+        TcpServer server{'\x00'};
+        TcpClient client{'\x00'};
+        shared_ptr<ClientIoContext> ioContext{Mode::POOLED == mode ? new ClientIoContext{1} : nullptr};
+        client.setIoContext(ioContext);
+        client.setInlineMessageWork(Mode::INLINE == mode || Mode::BUSY_POLL == mode);
+        server.setInlineMessageWork(Mode::INLINE == mode || Mode::BUSY_POLL == mode);
+        if (Mode::BUSY_POLL == mode)
+        {
+            client.setBusyPoll(BusyPollPolicy{chrono::microseconds{100}, {}});
+            server.setBusyPoll(BusyPollPolicy{chrono::microseconds{100}, {}});
+        }
+
+        // Client measures, server echoes
+        unique_ptr<Samples> samples{new Samples{ONE_WAY_MESSAGES}};
+        client.setWorkOnMessage([&samples](const string msg)
+                                { samples->add(msg); });
+        server.setWorkOnMessage([&server](const int clientId, const string msg)
+                                { server.sendMsg(clientId, msg); });
+
+        // Connect
+        int port{FIRST_PORT};
+        while (SERVER_START_OK != server.start(port))
+            port += 1;
+        if (CLIENT_START_OK != client.start("localhost", port))
+        {
+            cout << name << ": Unable to connect" << endl;
+            return;
+        }
+        while (server.getAllClientIds().empty())
+            this_thread::sleep_for(chrono::milliseconds{1});
+        const int clientId{server.getAllClientIds()[0]};
+
+        cout << name << ":" << endl;
+
+        // One-way latency
+        for (size_t i{0}; i < ONE_WAY_MESSAGES; i += 1)
+        {
+            server.sendMsg(clientId, to_string(nowNs()));
+            this_thread::sleep_for(SEND_INTERVAL);
+        }
+        if (samples->waitFor(ONE_WAY_MESSAGES))
+            printPercentiles("One-way", samples->latencies);
+        else
+            cout << "  One-way: Messages lost" << endl;
+
+        // Round-trip latency (One message in flight at a time)
+        samples.reset(new Samples{ROUND_TRIPS});
+        bool complete{true};
+        for (size_t i{0}; i < ROUND_TRIPS && complete; i += 1)
+        {
+            client.sendMsg(to_string(nowNs()));
+            complete = samples->waitFor(i + 1);
+        }
+        if (complete)
+            printPercentiles("Round-trip", samples->latencies);
+        else
+            cout << "  Round-trip: Messages lost" << endl;
+
+        client.stop();
+        server.stop();
+        return;
+    }
+}
+
+int main()
+{
+    run("Thread per message", Mode::THREAD_PER_MESSAGE);
+    run("Pooled (I/O context with 1 worker)", Mode::POOLED);
+    run("Inline (Receive thread)", Mode::INLINE);
+    run("Busy poll (Receive thread, 100 us budget)", Mode::BUSY_POLL);
+    return 0;
+}
@@ -0,0 +1,88 @@
+// Benchmark: Sending bursts of small messages over a local TCP connection with and without send batches
+// Each burst is sent either message by message (One send call and segment per message) or in a batch (One send call per burst).
+// The time is measured until the receiving client has handled all messages.
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "TcpServer.hpp"
+#include "TcpClient.hpp"
+#include "BenchmarkHelpers.h"
+
+using namespace std;
+using namespace tcp;
+
+namespace
+{
+    // Number of bursts and messages per burst
+    const uint64_t BURSTS{2000};
+    const size_t BURST_SIZE{32};
+
+    // Payload of each message
+    const string MESSAGE(48, 'x');
+
+    // First port tried for the server
+    const int FIRST_PORT{30100};
+
+    /**
+     * @brief Measure and print the time per message for one variant
+     *
+     * @param name
+     * @param batched   Send each burst in a batch
+     */
+    void run(const string &name, const bool batched)
+    {
+        TcpServer server{'\x00'};
+        TcpClient client{'\x00'};
+        atomic<uint64_t> received{0};
+        client.setInlineMessageWork(true);
+        client.setWorkOnMessage([&received](const string)
+                                { received.fetch_add(1, memory_order_relaxed); });
+
+        // Connect
+        int port{FIRST_PORT};
+        while (SERVER_START_OK != server.start(port))
+            port += 1;
+        if (CLIENT_START_OK != client.start("localhost", port))
+        {
+            cout << name << ": Unable to connect" << endl;
+            return;
+        }
+        while (server.getAllClientIds().empty())
+            this_thread::sleep_for(chrono::milliseconds{1});
+        const int clientId{server.getAllClientIds()[0]};
+
+        // Send all bursts and wait until all messages are handled
+        const double nsPerBurst{BenchmarkHelpers::measureNsPerOp(BURSTS, [&](const uint64_t i)
+                                                                 {
+                                                                     if (batched)
+                                                                     {
+                                                                         SendBatch batch{server, clientId};
+                                                                         for (size_t m{0}; m < BURST_SIZE; m += 1)
+                                                                             server.sendMsg(clientId, MESSAGE);
+                                                                     }
+                                                                     else
+                                                                     {
+                                                                         for (size_t m{0}; m < BURST_SIZE; m += 1)
+                                                                             server.sendMsg(clientId, MESSAGE);
+                                                                     }
+
+                                                                     // Wait for the burst to be handled, so bursts don't merge in the socket buffer
+                                                                     while (received.load(memory_order_relaxed) < (i + 1) * BURST_SIZE)
+                                                                         this_thread::yield(); })};
+        BenchmarkHelpers::printResult(name, nsPerBurst / BURST_SIZE, "ns/msg");
+
+        client.stop();
+        server.stop();
+        return;
+    }
+}
+
+int main()
+{
+    run("Message by message", false);
+    run("Batched (" + to_string(BURST_SIZE) + " messages per batch)", true);
+    return 0;
+}
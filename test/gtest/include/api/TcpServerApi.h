@@ -53,6 +53,13 @@ namespace TestApi
          */
         ::std::vector<int> getClientIds();
 
+        /**
+         * @brief Get IDs of all connected clients by visiting them one by one
+         *
+         * @return vector<int> Vector of visited client IDs
+         */
+        ::std::vector<int> getClientIdsVisited();
+
         /**
          * @brief Get the IP of a specific connected client
          *
@@ -61,6 +68,14 @@ namespace TestApi
          */
         ::std::string getClientIp(const int clientId) const;
 
+        /**
+         * @brief Get the connection metadata of a specific connected client
+         *
+         * @param clientId ID of the client
+         * @return ConnectionInfo
+         */
+        ::tcp::ConnectionInfo getClientInfo(const int clientId) const;
+
     private:
         /**
          * @brief Buffer incoming messages
@@ -0,0 +1,53 @@
+#ifndef CONTINUOUS_TCP_CONNECTION_TEST_DATAWORKER_H_
+#define CONTINUOUS_TCP_CONNECTION_TEST_DATAWORKER_H_
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <sstream>
+#include <string>
+
+#include "TcpServer.hpp"
+#include "TcpClient.hpp"
+#include "TestDefines.h"
+
+namespace Test
+{
+    class Continuous_TcpConnection_Test_DataWorker : public testing::Test
+    {
+    public:
+        Continuous_TcpConnection_Test_DataWorker();
+        virtual ~Continuous_TcpConnection_Test_DataWorker();
+
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Start server and connect client (Data workers must be set before)
+         */
+        void connect();
+
+        // Stream the client forwards to if no data worker is set
+        ::std::ostringstream streamClient;
+
+        // TCP Server and Client in continuous mode
+        ::tcp::TcpServer tcpServer{};
+        ::tcp::TcpClient tcpClient{streamClient};
+
+        // Data received by the data workers and number of calls
+        ::std::string dataServer;
+        ::std::string dataClient;
+        size_t callsServer{0};
+        size_t callsClient{0};
+        ::std::mutex data_m;
+
+        // Port to use
+        int port;
+
+        // Client ID
+        int clientId;
+    };
+} // namespace Test
+
+#endif // CONTINUOUS_TCP_CONNECTION_TEST_DATAWORKER_H_
@@ -0,0 +1,55 @@
+#ifndef CONTINUOUS_TCP_CONNECTION_TEST_READPAUSE_H_
+#define CONTINUOUS_TCP_CONNECTION_TEST_READPAUSE_H_
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+#include "TcpServer.hpp"
+#include "TcpClient.hpp"
+#include "TestDefines.h"
+
+namespace Test
+{
+    class Continuous_TcpConnection_Test_ReadPause : public testing::Test
+    {
+    public:
+        Continuous_TcpConnection_Test_ReadPause();
+        virtual ~Continuous_TcpConnection_Test_ReadPause();
+
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Get the number of bytes received by the data workers
+         *
+         * @return size_t
+         */
+        size_t getReceivedServer();
+        size_t getReceivedClient();
+
+        // Stream the client forwards to if no data worker is set
+        ::std::ostringstream streamClient;
+
+        // TCP Server and Client in continuous mode
+        ::tcp::TcpServer tcpServer{};
+        ::tcp::TcpClient tcpClient{streamClient};
+
+        // Data received by the data workers
+        ::std::string dataServer;
+        ::std::string dataClient;
+        ::std::mutex data_m;
+
+        // Port to use
+        int port;
+
+        // Client ID
+        int clientId;
+    };
+} // namespace Test
+
+#endif // CONTINUOUS_TCP_CONNECTION_TEST_READPAUSE_H_
@@ -0,0 +1,57 @@
+#ifndef CONTINUOUS_TCP_CONNECTION_TEST_SPLICE_H_
+#define CONTINUOUS_TCP_CONNECTION_TEST_SPLICE_H_
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+#include "TcpServer.hpp"
+#include "TcpClient.hpp"
+#include "TestDefines.h"
+
+namespace Test
+{
+    class Continuous_TcpConnection_Test_Splice : public testing::Test
+    {
+    public:
+        Continuous_TcpConnection_Test_Splice();
+        virtual ~Continuous_TcpConnection_Test_Splice();
+
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Start server and connect client (Splice targets must be set before)
+         */
+        void connect();
+
+        /**
+         * @brief Read the content of a file
+         *
+         * @param path
+         * @return string
+         */
+        static ::std::string readFile(const ::std::string &path);
+
+        // Stream the client forwards to if no splice target is set
+        ::std::ostringstream streamClient;
+
+        // TCP Server and Client in continuous mode
+        ::tcp::TcpServer tcpServer{};
+        ::tcp::TcpClient tcpClient{streamClient};
+
+        // Files used as splice targets
+        ::std::string pathServer;
+        ::std::string pathClient;
+
+        // Port to use
+        int port;
+
+        // Client ID
+        int clientId;
+    };
+} // namespace Test
+
+#endif // CONTINUOUS_TCP_CONNECTION_TEST_SPLICE_H_
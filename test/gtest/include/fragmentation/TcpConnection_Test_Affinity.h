@@ -0,0 +1,54 @@
+#ifndef FRAGMENTATION_TCP_CONNECTION_TEST_AFFINITY_H_
+#define FRAGMENTATION_TCP_CONNECTION_TEST_AFFINITY_H_
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "TcpServer.hpp"
+#include "TcpClient.hpp"
+#include "TestDefines.h"
+
+namespace Test
+{
+    class Fragmentation_TcpConnection_Test_Affinity : public testing::Test
+    {
+    public:
+        Fragmentation_TcpConnection_Test_Affinity();
+        virtual ~Fragmentation_TcpConnection_Test_Affinity();
+
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Start server and client, wait for the connection and send one message in each direction
+         */
+        void connectAndExchange();
+
+        /**
+         * @brief Check if the calling thread is pinned to CPU 0 only
+         *
+         * @return bool
+         */
+        static bool pinnedToCpu0();
+
+        // TCP Server and Client in fragmentation mode
+        ::tcp::TcpServer tcpServer{'\x00'};
+        ::tcp::TcpClient tcpClient{'\x00'};
+
+        // Messages received by server and client and if their workers were pinned to CPU 0
+        ::std::vector<::std::string> serverMessages;
+        ::std::vector<::std::string> clientMessages;
+        ::std::vector<bool> serverWorkersPinned;
+        ::std::vector<bool> clientWorkersPinned;
+        ::std::mutex messages_m;
+
+        // Port to use
+        int port;
+    };
+} // namespace Test
+
+#endif // FRAGMENTATION_TCP_CONNECTION_TEST_AFFINITY_H_
@@ -0,0 +1,52 @@
+#ifndef FRAGMENTATION_TCP_CONNECTION_TEST_BUSYPOLL_H_
+#define FRAGMENTATION_TCP_CONNECTION_TEST_BUSYPOLL_H_
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "TcpServer.hpp"
+#include "TcpClient.hpp"
+#include "TestDefines.h"
+
+namespace Test
+{
+    class Fragmentation_TcpConnection_Test_BusyPoll : public testing::Test
+    {
+    public:
+        Fragmentation_TcpConnection_Test_BusyPoll();
+        virtual ~Fragmentation_TcpConnection_Test_BusyPoll();
+
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Start server and client and wait for the connection
+         */
+        void connect();
+
+        /**
+         * @brief Send messages in both directions and check if all are received in order
+         *
+         * @param count Number of messages per direction
+         */
+        void exchangeMessages(const size_t count);
+
+        // TCP Server and Client in fragmentation mode
+        ::tcp::TcpServer tcpServer{'\x00'};
+        ::tcp::TcpClient tcpClient{'\x00'};
+
+        // Messages received by server and client
+        ::std::vector<::std::string> serverMessages;
+        ::std::vector<::std::string> clientMessages;
+        ::std::mutex messages_m;
+
+        // Port to use
+        int port;
+    };
+} // namespace Test
+
+#endif // FRAGMENTATION_TCP_CONNECTION_TEST_BUSYPOLL_H_
@@ -0,0 +1,46 @@
+#ifndef FRAGMENTATION_TCP_CONNECTION_TEST_CHUNKSIZE_H_
+#define FRAGMENTATION_TCP_CONNECTION_TEST_CHUNKSIZE_H_
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "TcpServer.hpp"
+#include "TcpClient.hpp"
+#include "TestDefines.h"
+
+namespace Test
+{
+    class Fragmentation_TcpConnection_Test_ChunkSize : public testing::Test
+    {
+    public:
+        Fragmentation_TcpConnection_Test_ChunkSize();
+        virtual ~Fragmentation_TcpConnection_Test_ChunkSize();
+
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        // Start server and connect client (Receive chunk size must be set before)
+        void connect();
+
+        // TCP Server and Client
+        ::tcp::TcpServer tcpServer{'\x00'};
+        ::tcp::TcpClient tcpClient{'\x00'};
+
+        // Received messages
+        ::std::vector<::std::string> messagesOnServer;
+        ::std::vector<::std::string> messagesOnClient;
+        ::std::mutex messages_m;
+
+        // Port to use
+        int port;
+
+        // Client ID
+        int clientId;
+    };
+} // namespace Test
+
+#endif // FRAGMENTATION_TCP_CONNECTION_TEST_CHUNKSIZE_H_
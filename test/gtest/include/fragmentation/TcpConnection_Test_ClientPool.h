@@ -0,0 +1,81 @@
+#ifndef FRAGMENTATION_TCP_CONNECTION_TEST_CLIENTPOOL_H_
+#define FRAGMENTATION_TCP_CONNECTION_TEST_CLIENTPOOL_H_
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "TcpClient.hpp"
+#include "api/TcpServerApi.h"
+#include "TestDefines.h"
+
+namespace Test
+{
+    /**
+     * @brief TCP client that can lose its connection on demand
+     */
+    class TcpClient_PoolProbe : public ::tcp::TcpClient
+    {
+    public:
+        TcpClient_PoolProbe() : ::tcp::TcpClient{'\x00'} {}
+
+        // Lose the connection without stopping the client
+        void dropConnection() { shutdown(this->tcpSocket, SHUT_RD); }
+    };
+
+    class Fragmentation_TcpConnection_Test_ClientPool : public testing::Test
+    {
+    public:
+        Fragmentation_TcpConnection_Test_ClientPool();
+        virtual ~Fragmentation_TcpConnection_Test_ClientPool();
+
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Create a new pool member and remember it
+         *
+         * @return unique_ptr<TcpClient_PoolProbe>
+         */
+        ::std::unique_ptr<TcpClient_PoolProbe> createMember();
+
+        /**
+         * @brief Wait until the server knows a number of clients
+         *
+         * @param server
+         * @param count
+         */
+        static void waitForClients(TestApi::TcpServerApi_fragmentation &server, const size_t count);
+
+        /**
+         * @brief Wait for a number of messages and count them per client
+         *
+         * @param count
+         * @return map<int, size_t> (Number of messages per client ID)
+         */
+        ::std::map<int, size_t> receiveMessages(const size_t count);
+
+        // TCP Server in fragmentation mode
+        TestApi::TcpServerApi_fragmentation tcpServer;
+
+        // All members ever created by the pool
+        ::std::vector<TcpClient_PoolProbe *> createdMembers;
+        ::std::mutex createdMembers_m;
+
+        // Pool of TCP clients
+        ::tcp::ClientPool<TcpClient_PoolProbe> roundRobinPool{[this]()
+                                                              { return createMember(); }};
+        ::tcp::ClientPool<TcpClient_PoolProbe> leastLoadedPool{[this]()
+                                                               { return createMember(); },
+                                                               ::tcp::ClientPoolBalancing::LEAST_LOADED};
+
+        // Port to use
+        int port;
+    };
+} // namespace Test
+
+#endif // FRAGMENTATION_TCP_CONNECTION_TEST_CLIENTPOOL_H_
@@ -0,0 +1,56 @@
+#ifndef FRAGMENTATION_TCP_CONNECTION_TEST_INLINEMESSAGE_H_
+#define FRAGMENTATION_TCP_CONNECTION_TEST_INLINEMESSAGE_H_
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "TcpServer.hpp"
+#include "TcpClient.hpp"
+#include "TestDefines.h"
+
+namespace Test
+{
+    class Fragmentation_TcpConnection_Test_InlineMessage : public testing::Test
+    {
+    public:
+        Fragmentation_TcpConnection_Test_InlineMessage();
+        virtual ~Fragmentation_TcpConnection_Test_InlineMessage();
+
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        // Handler policy with its own inline message capacity, recording all received messages
+        class InlineHandler
+        {
+        public:
+            using MessageType = ::tcp::BasicMessage<64>;
+
+            ::std::ostream *createForwardStream(const int) { return nullptr; }
+            void *established(const int) { return nullptr; }
+            void message(const int, void *, MessageType msg)
+            {
+                ::std::lock_guard<::std::mutex> lck{messages_m};
+                messagesInline.push_back(msg.isInline());
+                messages.push_back(::std::move(msg).str());
+            }
+            void closed(const int, void *) {}
+
+            ::std::vector<::std::string> messages;
+            ::std::vector<bool> messagesInline;
+            ::std::mutex messages_m;
+        };
+
+        // TCP Server and Client
+        ::tcp::BasicTcpServer<InlineHandler> tcpServer{'\x00'};
+        ::tcp::TcpClient tcpClient{'\x00'};
+
+        // Port to use
+        int port;
+    };
+} // namespace Test
+
+#endif // FRAGMENTATION_TCP_CONNECTION_TEST_INLINEMESSAGE_H_
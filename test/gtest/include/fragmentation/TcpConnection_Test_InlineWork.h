@@ -0,0 +1,56 @@
+#ifndef FRAGMENTATION_TCP_CONNECTION_TEST_INLINEWORK_H_
+#define FRAGMENTATION_TCP_CONNECTION_TEST_INLINEWORK_H_
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "TcpServer.hpp"
+#include "TcpClient.hpp"
+#include "TestDefines.h"
+
+namespace Test
+{
+    class Fragmentation_TcpConnection_Test_InlineWork : public testing::Test
+    {
+    public:
+        Fragmentation_TcpConnection_Test_InlineWork();
+        virtual ~Fragmentation_TcpConnection_Test_InlineWork();
+
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Start server and client and wait for the connection
+         */
+        void connect();
+
+        /**
+         * @brief Wait until a number of messages is received
+         *
+         * @param messages
+         * @param count
+         */
+        void waitForMessages(const ::std::vector<::std::string> &messages, const size_t count);
+
+        // TCP Server and Client in fragmentation mode
+        ::tcp::TcpServer tcpServer{'\x00'};
+        ::tcp::TcpClient tcpClient{'\x00'};
+
+        // Messages received by server and client and the threads the workers ran in
+        ::std::vector<::std::string> serverMessages;
+        ::std::vector<::std::string> clientMessages;
+        ::std::set<::std::thread::id> workerThreads;
+        ::std::mutex messages_m;
+
+        // Port to use
+        int port;
+    };
+} // namespace Test
+
+#endif // FRAGMENTATION_TCP_CONNECTION_TEST_INLINEWORK_H_
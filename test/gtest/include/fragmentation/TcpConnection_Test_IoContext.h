@@ -0,0 +1,70 @@
+#ifndef FRAGMENTATION_TCP_CONNECTION_TEST_IOCONTEXT_H_
+#define FRAGMENTATION_TCP_CONNECTION_TEST_IOCONTEXT_H_
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "TcpServer.hpp"
+#include "TcpClient.hpp"
+#include "TestDefines.h"
+
+namespace Test
+{
+    /**
+     * @brief TCP client that can lose its connection on demand
+     */
+    class TcpClient_IoContextProbe : public ::tcp::TcpClient
+    {
+    public:
+        TcpClient_IoContextProbe() : ::tcp::TcpClient{'\x00'} {}
+
+        // Lose the connection without stopping the client
+        void dropConnection() { shutdown(this->tcpSocket, SHUT_RD); }
+    };
+
+    class Fragmentation_TcpConnection_Test_IoContext : public testing::Test
+    {
+    public:
+        Fragmentation_TcpConnection_Test_IoContext();
+        virtual ~Fragmentation_TcpConnection_Test_IoContext();
+
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Start clients attached to the shared I/O context and wait until the server knows all of them
+         *
+         * @param count
+         */
+        void startClients(const size_t count);
+
+        /**
+         * @brief Get the messages received by a client
+         *
+         * @param client
+         * @return vector<string>
+         */
+        ::std::vector<::std::string> getReceived(const size_t client);
+
+        // Shared I/O context with 2 workers
+        ::std::shared_ptr<::tcp::ClientIoContext> ioContext{new ::tcp::ClientIoContext{2}};
+
+        // TCP Server and Clients in fragmentation mode
+        ::tcp::TcpServer tcpServer{'\x00'};
+        ::std::vector<::std::unique_ptr<::tcp::TcpClient>> tcpClients;
+
+        // Messages received by each client
+        ::std::vector<::std::vector<::std::string>> received;
+        ::std::mutex received_m;
+
+        // Port to use
+        int port;
+    };
+} // namespace Test
+
+#endif // FRAGMENTATION_TCP_CONNECTION_TEST_IOCONTEXT_H_
@@ -0,0 +1,51 @@
+#ifndef FRAGMENTATION_TCP_CONNECTION_TEST_MAXLENGTH_H_
+#define FRAGMENTATION_TCP_CONNECTION_TEST_MAXLENGTH_H_
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "TcpServer.hpp"
+#include "TcpClient.hpp"
+#include "TestDefines.h"
+
+namespace Test
+{
+    class Fragmentation_TcpConnection_Test_MaxLength : public testing::Test
+    {
+    public:
+        Fragmentation_TcpConnection_Test_MaxLength();
+        virtual ~Fragmentation_TcpConnection_Test_MaxLength();
+
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        // Maximum message length on receiving side
+        static constexpr size_t MAXIMUM_MESSAGE_LENGTH{100};
+
+        // Pairs of TCP Server and Client, each with limited receiver and unlimited sender
+        ::tcp::TcpServer tcpServer{'\x00', "", MAXIMUM_MESSAGE_LENGTH};
+        ::tcp::TcpClient tcpClient{'\x00'};
+        ::tcp::TcpServer tcpServerUnlimited{'\x00'};
+        ::tcp::TcpClient tcpClientLimited{'\x00', "", MAXIMUM_MESSAGE_LENGTH};
+
+        // Received messages and reported oversized messages
+        ::std::vector<::std::string> messagesOnServer;
+        ::std::vector<::std::string> messagesOnClient;
+        ::std::vector<int> oversizedOnServer;
+        int oversizedOnClient{0};
+        ::std::mutex messages_m;
+
+        // Ports to use
+        int port;
+        int portUnlimited;
+
+        // Client ID on unlimited server
+        int clientIdUnlimited;
+    };
+} // namespace Test
+
+#endif // FRAGMENTATION_TCP_CONNECTION_TEST_MAXLENGTH_H_
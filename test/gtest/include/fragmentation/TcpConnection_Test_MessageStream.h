@@ -0,0 +1,55 @@
+#ifndef FRAGMENTATION_TCP_CONNECTION_TEST_MESSAGESTREAM_H_
+#define FRAGMENTATION_TCP_CONNECTION_TEST_MESSAGESTREAM_H_
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "TcpServer.hpp"
+#include "TcpClient.hpp"
+#include "TestDefines.h"
+
+namespace Test
+{
+    class Fragmentation_TcpConnection_Test_MessageStream : public testing::Test
+    {
+    public:
+        Fragmentation_TcpConnection_Test_MessageStream();
+        virtual ~Fragmentation_TcpConnection_Test_MessageStream();
+
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        // Message streamed piece by piece
+        struct StreamedMessage
+        {
+            ::std::string content;
+            size_t chunks{0};
+            bool ended{false};
+            bool complete{false};
+        };
+
+        // Maximum message length
+        static constexpr size_t MAXIMUM_MESSAGE_LENGTH{10000000};
+
+        // TCP Server and Client
+        ::tcp::TcpServer tcpServer{'\x00', "", MAXIMUM_MESSAGE_LENGTH};
+        ::tcp::TcpClient tcpClient{'\x00', "", MAXIMUM_MESSAGE_LENGTH};
+
+        // Messages streamed on server and client
+        ::std::vector<StreamedMessage> messagesOnServer;
+        ::std::vector<StreamedMessage> messagesOnClient;
+        ::std::mutex messages_m;
+
+        // Port to use
+        int port;
+
+        // Client ID
+        int clientId;
+    };
+} // namespace Test
+
+#endif // FRAGMENTATION_TCP_CONNECTION_TEST_MESSAGESTREAM_H_
@@ -0,0 +1,40 @@
+#ifndef FRAGMENTATION_TCP_CONNECTION_TEST_REQUEST_H_
+#define FRAGMENTATION_TCP_CONNECTION_TEST_REQUEST_H_
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "TcpServer.hpp"
+#include "TcpClient.hpp"
+#include "TestDefines.h"
+
+namespace Test
+{
+    class Fragmentation_TcpConnection_Test_Request : public testing::Test
+    {
+    public:
+        Fragmentation_TcpConnection_Test_Request();
+        virtual ~Fragmentation_TcpConnection_Test_Request();
+
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        // TCP Server and Client in fragmentation mode
+        ::tcp::TcpServer tcpServer{'\x00'};
+        ::tcp::TcpClient tcpClient{'\x00'};
+
+        // Plain messages received by server and client
+        ::std::vector<::std::string> serverMessages;
+        ::std::vector<::std::string> clientMessages;
+        ::std::mutex messages_m;
+
+        // Port to use
+        int port;
+    };
+} // namespace Test
+
+#endif // FRAGMENTATION_TCP_CONNECTION_TEST_REQUEST_H_
@@ -0,0 +1,50 @@
+#ifndef FRAGMENTATION_TCP_CONNECTION_TEST_SENDBATCH_H_
+#define FRAGMENTATION_TCP_CONNECTION_TEST_SENDBATCH_H_
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "TcpServer.hpp"
+#include "TcpClient.hpp"
+#include "TestDefines.h"
+
+namespace Test
+{
+    class Fragmentation_TcpConnection_Test_SendBatch : public testing::Test
+    {
+    public:
+        Fragmentation_TcpConnection_Test_SendBatch();
+        virtual ~Fragmentation_TcpConnection_Test_SendBatch();
+
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Get the number of received messages after waiting until a number of messages is received (Or a timeout)
+         *
+         * @param messages
+         * @param count
+         * @return size_t
+         */
+        size_t waitForMessages(const ::std::vector<::std::string> &messages, const size_t count);
+
+        // TCP Server and Client in fragmentation mode
+        ::tcp::TcpServer tcpServer{'\x00'};
+        ::tcp::TcpClient tcpClient{'\x00'};
+
+        // Messages received by server and client
+        ::std::vector<::std::string> serverMessages;
+        ::std::vector<::std::string> clientMessages;
+        ::std::mutex messages_m;
+
+        // Port to use and ID of the connected client
+        int port;
+        int clientId;
+    };
+} // namespace Test
+
+#endif // FRAGMENTATION_TCP_CONNECTION_TEST_SENDBATCH_H_
@@ -0,0 +1,58 @@
+#ifndef FRAGMENTATION_TCP_CONNECTION_TEST_SPILLTODISK_H_
+#define FRAGMENTATION_TCP_CONNECTION_TEST_SPILLTODISK_H_
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "TcpServer.hpp"
+#include "TcpClient.hpp"
+#include "TestDefines.h"
+
+namespace Test
+{
+    class Fragmentation_TcpConnection_Test_SpillToDisk : public testing::Test
+    {
+    public:
+        Fragmentation_TcpConnection_Test_SpillToDisk();
+        virtual ~Fragmentation_TcpConnection_Test_SpillToDisk();
+
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        // Handler policy working on the message itself, recording all received messages and if they were spilled
+        class SpillHandler
+        {
+        public:
+            ::std::ostream *createForwardStream(const int) { return nullptr; }
+            void *established(const int) { return nullptr; }
+            void message(const int, void *, ::tcp::Message msg)
+            {
+                ::std::lock_guard<::std::mutex> lck{messages_m};
+                messagesSpilled.push_back(msg.isSpilled());
+                messages.push_back(::std::string{msg.view()});
+            }
+            void closed(const int, void *) {}
+
+            ::std::vector<::std::string> messages;
+            ::std::vector<bool> messagesSpilled;
+            ::std::mutex messages_m;
+        };
+
+        // TCP Server and Client
+        ::tcp::BasicTcpServer<SpillHandler> tcpServer{'\x00'};
+        ::tcp::TcpClient tcpClient{'\x00'};
+
+        // Messages received by the client
+        ::std::vector<::std::string> messagesClient;
+        ::std::mutex messagesClient_m;
+
+        // Port to use
+        int port;
+    };
+} // namespace Test
+
+#endif // FRAGMENTATION_TCP_CONNECTION_TEST_SPILLTODISK_H_
@@ -0,0 +1,46 @@
+#ifndef FRAGMENTATION_TCP_CONNECTION_TEST_STATICFRAMING_H_
+#define FRAGMENTATION_TCP_CONNECTION_TEST_STATICFRAMING_H_
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "TcpServer.hpp"
+#include "TcpClient.hpp"
+#include "TestDefines.h"
+
+namespace Test
+{
+    class Fragmentation_TcpConnection_Test_StaticFraming : public testing::Test
+    {
+    public:
+        Fragmentation_TcpConnection_Test_StaticFraming();
+        virtual ~Fragmentation_TcpConnection_Test_StaticFraming();
+
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        // Framing fixed at compile time (Newline delimiter, maximum message length 100 bytes)
+        using Framing = ::tcp::DelimiterFraming<'\n', 100>;
+
+        // TCP Server and Client
+        ::tcp::BasicTcpServer<::tcp::ServerCallbacks, Framing> tcpServer{};
+        ::tcp::BasicTcpClient<::tcp::ClientCallbacks, Framing> tcpClient{};
+
+        // Received messages
+        ::std::vector<::std::string> messagesOnServer;
+        ::std::vector<::std::string> messagesOnClient;
+        ::std::mutex messages_m;
+
+        // Port to use
+        int port;
+
+        // Client ID
+        int clientId;
+    };
+} // namespace Test
+
+#endif // FRAGMENTATION_TCP_CONNECTION_TEST_STATICFRAMING_H_
@@ -0,0 +1,40 @@
+#ifndef FRAGMENTATION_TLS_CONNECTION_TEST_BUSYPOLL_H_
+#define FRAGMENTATION_TLS_CONNECTION_TEST_BUSYPOLL_H_
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "TlsServer.hpp"
+#include "TlsClient.hpp"
+#include "TestDefines.h"
+
+namespace Test
+{
+    class Fragmentation_TlsConnection_Test_BusyPoll : public testing::Test
+    {
+    public:
+        Fragmentation_TlsConnection_Test_BusyPoll();
+        virtual ~Fragmentation_TlsConnection_Test_BusyPoll();
+
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        // TLS Server and Client in fragmentation mode
+        ::tcp::TlsServer tlsServer{'\x00'};
+        ::tcp::TlsClient tlsClient{'\x00'};
+
+        // Messages received by server and client
+        ::std::vector<::std::string> serverMessages;
+        ::std::vector<::std::string> clientMessages;
+        ::std::mutex messages_m;
+
+        // Port to use
+        int port;
+    };
+} // namespace Test
+
+#endif // FRAGMENTATION_TLS_CONNECTION_TEST_BUSYPOLL_H_
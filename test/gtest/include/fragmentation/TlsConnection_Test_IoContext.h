@@ -0,0 +1,151 @@
+#ifndef FRAGMENTATION_TLS_CONNECTION_TEST_IOCONTEXT_H_
+#define FRAGMENTATION_TLS_CONNECTION_TEST_IOCONTEXT_H_
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+
+#include "TlsServer.hpp"
+#include "TlsClient.hpp"
+#include "TestDefines.h"
+
+namespace Test
+{
+    class Fragmentation_TlsConnection_Test_IoContext : public testing::Test
+    {
+    public:
+        Fragmentation_TlsConnection_Test_IoContext();
+        virtual ~Fragmentation_TlsConnection_Test_IoContext();
+
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        // Proxy forwarding one connection to the server, that can send data from the server in two pieces with a pause in between
+        class SplitProxy
+        {
+        public:
+            virtual ~SplitProxy() { stop(); }
+
+            // Listen on the given port and forward the next connection to the target port (Return false if listening fails)
+            bool start(const int port, const int targetPort)
+            {
+                struct sockaddr_in address
+                {
+                };
+                address.sin_family = AF_INET;
+                address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+                address.sin_port = htons(port);
+                listenFd = socket(AF_INET, SOCK_STREAM, 0);
+                if (0 > listenFd || bind(listenFd, (struct sockaddr *)&address, sizeof(address)) || listen(listenFd, 1))
+                    return false;
+
+                acceptor = ::std::thread{[this, targetPort]()
+                                         {
+                                             // Connect the accepted client to the target
+                                             clientFd = accept(listenFd, nullptr, nullptr);
+                                             if (0 > clientFd)
+                                                 return;
+                                             struct sockaddr_in target
+                                             {
+                                             };
+                                             target.sin_family = AF_INET;
+                                             target.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+                                             target.sin_port = htons(targetPort);
+                                             serverFd = socket(AF_INET, SOCK_STREAM, 0);
+                                             if (0 > serverFd || connect(serverFd, (struct sockaddr *)&target, sizeof(target)))
+                                                 return;
+
+                                             // Forward in both directions
+                                             upstream = ::std::thread{[this]()
+                                                                      { forward(clientFd, serverFd, false); }};
+                                             forward(serverFd, clientFd, true);
+                                         }};
+                return true;
+            }
+
+            // Stop forwarding and close all sockets
+            void stop()
+            {
+                for (int fd : {listenFd, clientFd, serverFd})
+                {
+                    if (0 <= fd)
+                        shutdown(fd, SHUT_RDWR);
+                }
+                if (acceptor.joinable())
+                    acceptor.join();
+                if (upstream.joinable())
+                    upstream.join();
+                for (int *fd : {&listenFd, &clientFd, &serverFd})
+                {
+                    if (0 <= *fd)
+                        close(*fd);
+                    *fd = -1;
+                }
+            }
+
+            // Send the next data from the server in two pieces with the given pause in between
+            void splitNext(const ::std::chrono::milliseconds pause)
+            {
+                splitPause = pause;
+                split = true;
+            }
+
+        private:
+            void forward(const int from, const int to, const bool splittable)
+            {
+                char buffer[65536];
+                ssize_t len;
+                while (0 < (len = recv(from, buffer, sizeof(buffer), 0)))
+                {
+                    ssize_t lenFirst{len};
+                    if (splittable && 1 < len && split.exchange(false))
+                    {
+                        lenFirst = len / 2;
+                        send(to, buffer, lenFirst, MSG_NOSIGNAL);
+                        ::std::this_thread::sleep_for(splitPause);
+                        len -= lenFirst;
+                    }
+                    else
+                        lenFirst = 0;
+                    if (0 > send(to, buffer + lenFirst, len, MSG_NOSIGNAL))
+                        return;
+                }
+            }
+
+            int listenFd{-1};
+            int clientFd{-1};
+            int serverFd{-1};
+            ::std::thread acceptor;
+            ::std::thread upstream;
+            ::std::atomic_bool split{false};
+            ::std::chrono::milliseconds splitPause{0};
+        };
+
+        // Shared I/O context with a single worker
+        ::std::shared_ptr<::tcp::ClientIoContext> ioContext{new ::tcp::ClientIoContext{1}};
+
+        // TLS Server and Clients in fragmentation mode
+        ::tcp::TlsServer tlsServer{'\x00'};
+        ::std::vector<::std::unique_ptr<::tcp::TlsClient>> tlsClients;
+
+        // Messages received by all clients
+        ::std::vector<::std::string> received;
+        ::std::mutex received_m;
+
+        // Port to use
+        int port;
+    };
+} // namespace Test
+
+#endif // FRAGMENTATION_TLS_CONNECTION_TEST_IOCONTEXT_H_
@@ -0,0 +1,52 @@
+#ifndef GENERAL_TCP_CLIENT_TEST_RECONNECT_H_
+#define GENERAL_TCP_CLIENT_TEST_RECONNECT_H_
+
+#include <gtest/gtest.h>
+#include <mutex>
+#include <vector>
+#include <utility>
+
+#include "TcpServerApi.h"
+#include "TcpClient.hpp"
+
+namespace Test
+{
+    /**
+     * @brief TCP client that can lose its connection on demand
+     */
+    class TcpClient_ReconnectProbe : public ::tcp::TcpClient
+    {
+    public:
+        TcpClient_ReconnectProbe() : ::tcp::TcpClient{'\x00'} {}
+
+        // Lose the connection without stopping the client
+        void dropConnection() { shutdown(this->tcpSocket, SHUT_RD); }
+    };
+
+    class General_TcpClient_Test_Reconnect : public testing::Test
+    {
+    public:
+        General_TcpClient_Test_Reconnect();
+        virtual ~General_TcpClient_Test_Reconnect();
+
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        // Wait until the reconnect worker is called the given number of times
+        bool waitForReconnects(const size_t count);
+
+        // TCP server and Client
+        TestApi::TcpServerApi_fragmentation tcpServer{};
+        TcpClient_ReconnectProbe tcpClient{};
+
+        // Calls of the reconnect worker (Success, attempts)
+        ::std::vector<::std::pair<bool, unsigned int>> reconnects;
+        ::std::mutex reconnects_m;
+
+        // Port to use
+        int port;
+    };
+}
+
+#endif // GENERAL_TCP_CLIENT_TEST_RECONNECT_H_
@@ -0,0 +1,54 @@
+#ifndef GENERAL_TCP_CONNECTION_TEST_SOCKETOPTIONS_H_
+#define GENERAL_TCP_CONNECTION_TEST_SOCKETOPTIONS_H_
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "TcpServer.hpp"
+#include "TcpClient.hpp"
+#include "TestDefines.h"
+
+namespace Test
+{
+    class General_TcpConnection_Test_SocketOptions : public testing::Test
+    {
+    public:
+        General_TcpConnection_Test_SocketOptions();
+        virtual ~General_TcpConnection_Test_SocketOptions();
+
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Start server and client and wait for the connection
+         */
+        void connect();
+
+        /**
+         * @brief Read an integer socket option
+         *
+         * @param fd
+         * @param level
+         * @param name
+         * @return int (-1 if reading fails)
+         */
+        static int getOption(const int fd, const int level, const int name);
+
+        // TCP Server and Client in fragmentation mode
+        ::tcp::TcpServer tcpServer{'\x00'};
+        ::tcp::TcpClient tcpClient{'\x00'};
+
+        // Messages received by the server
+        ::std::vector<::std::string> serverMessages;
+        ::std::mutex messages_m;
+
+        // Port to use
+        int port;
+    };
+} // namespace Test
+
+#endif // GENERAL_TCP_CONNECTION_TEST_SOCKETOPTIONS_H_
@@ -0,0 +1,51 @@
+#ifndef GENERAL_TCP_SERVER_TEST_USERCONTEXT_H_
+#define GENERAL_TCP_SERVER_TEST_USERCONTEXT_H_
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "TcpServer.hpp"
+#include "TcpClientApi.h"
+
+namespace Test
+{
+    class General_TcpServer_Test_UserContext : public testing::Test
+    {
+    public:
+        General_TcpServer_Test_UserContext();
+        virtual ~General_TcpServer_Test_UserContext();
+
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        // Session state stored as user context per connection
+        struct Session
+        {
+            int clientId;
+            ::std::vector<::std::string> messages;
+            ::std::mutex messages_m;
+        };
+
+        // All sessions created on established connections and all sessions passed on closed connections
+        ::std::vector<::std::unique_ptr<Session>> sessions;
+        ::std::vector<Session *> closedSessions;
+        ::std::mutex sessions_m;
+
+        // TCP Server and Client
+        ::tcp::TcpServer tcpServer{'\x00'};
+        TestApi::TcpClientApi_fragmentation tcpClient{};
+
+        // Port to use
+        int port;
+
+        // Client ID
+        int clientId;
+    };
+} // namespace Test
+
+#endif // GENERAL_TCP_SERVER_TEST_USERCONTEXT_H_
@@ -0,0 +1,49 @@
+#ifndef GENERAL_TLS_CLIENT_TEST_RECONNECT_H_
+#define GENERAL_TLS_CLIENT_TEST_RECONNECT_H_
+
+#include <gtest/gtest.h>
+#include <atomic>
+
+#include "TlsServerApi.h"
+#include "TlsClient.hpp"
+
+namespace Test
+{
+    /**
+     * @brief TLS client that can lose its connection on demand
+     */
+    class TlsClient_ReconnectProbe : public ::tcp::TlsClient
+    {
+    public:
+        TlsClient_ReconnectProbe() : ::tcp::TlsClient{'\x00'} {}
+
+        // Lose the connection without stopping the client
+        void dropConnection() { shutdown(this->tcpSocket, SHUT_RD); }
+
+        // Check if the current connection resumed the last session
+        bool isSessionReused() { return 1 == SSL_session_reused(this->clientSocket.get()); }
+    };
+
+    class General_TlsClient_Test_Reconnect : public testing::Test
+    {
+    public:
+        General_TlsClient_Test_Reconnect();
+        virtual ~General_TlsClient_Test_Reconnect();
+
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        // TLS server and Client
+        TestApi::TlsServerApi_fragmentation tlsServer{};
+        TlsClient_ReconnectProbe tlsClient{};
+
+        // Number of successful reconnects
+        ::std::atomic<int> reconnects{0};
+
+        // Port to use
+        int port;
+    };
+}
+
+#endif // GENERAL_TLS_CLIENT_TEST_RECONNECT_H_
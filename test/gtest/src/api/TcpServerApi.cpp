@@ -71,11 +71,24 @@ vector<int> TcpServerApi_fragmentation::getClientIds()
     return tcpServer.getAllClientIds();
 }
 
+vector<int> TcpServerApi_fragmentation::getClientIdsVisited()
+{
+    vector<int> clientIds;
+    tcpServer.forEachClient([&clientIds](const int clientId)
+                          { clientIds.push_back(clientId); });
+    return clientIds;
+}
+
 string TcpServerApi_fragmentation::getClientIp(const int clientId) const
 {
     return tcpServer.getClientIp(clientId);
 }
 
+ConnectionInfo TcpServerApi_fragmentation::getClientInfo(const int clientId) const
+{
+    return *tcpServer.getClientInfo(clientId);
+}
+
 void TcpServerApi_fragmentation::workOnMessage(const int tcpClientId, const string tcpMsgFromClient)
 {
     lock_guard<mutex> lck{bufferedMsg_m};
@@ -73,11 +73,24 @@ vector<int> TlsServerApi_fragmentation::getClientIds()
     return tlsServer.getAllClientIds();
 }
 
+vector<int> TlsServerApi_fragmentation::getClientIdsVisited()
+{
+    vector<int> clientIds;
+    tlsServer.forEachClient([&clientIds](const int clientId)
+                          { clientIds.push_back(clientId); });
+    return clientIds;
+}
+
 string TlsServerApi_fragmentation::getClientIp(const int clientId) const
 {
     return tlsServer.getClientIp(clientId);
 }
 
+ConnectionInfo TlsServerApi_fragmentation::getClientInfo(const int clientId) const
+{
+    return *tlsServer.getClientInfo(clientId);
+}
+
 string TlsServerApi_fragmentation::getSubjPartFromClientCert(const int clientId, const int subjPart)
 {
     return tlsServer.getSubjPartFromClientCert(clientId, subjPart);
@@ -0,0 +1,132 @@
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string>
+
+#include "continuous/TcpConnection_Test_DataWorker.h"
+#include "HelperFunctions.h"
+
+using namespace std;
+using namespace Test;
+using namespace tcp;
+
+Continuous_TcpConnection_Test_DataWorker::Continuous_TcpConnection_Test_DataWorker() {}
+Continuous_TcpConnection_Test_DataWorker::~Continuous_TcpConnection_Test_DataWorker() {}
+
+void Continuous_TcpConnection_Test_DataWorker::SetUp()
+{
+    // Get free TCP port
+    port = HelperFunctions::getFreePort();
+    ASSERT_NE(port, -1) << "No free port found";
+
+    return;
+}
+
+void Continuous_TcpConnection_Test_DataWorker::TearDown()
+{
+    // Stop TCP client and server
+    tcpClient.stop();
+    tcpServer.stop();
+
+    // Check if no pipe error occurred
+    EXPECT_FALSE(HelperFunctions::getAndResetPipeError()) << "Pipe error occurred!";
+
+    return;
+}
+
+void Continuous_TcpConnection_Test_DataWorker::connect()
+{
+    // Start TCP server and connect client
+    ASSERT_EQ(tcpServer.start(port), SERVER_START_OK) << "Unable to start TCP server on port " << port;
+    ASSERT_EQ(tcpClient.start("localhost", port), CLIENT_START_OK) << "Unable to connect TCP client to localhost on port " << port;
+
+    // Wait for connection to be established
+    for (int i{0}; i < 100 && tcpServer.getAllClientIds().empty(); i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+    vector<int> clientIds{tcpServer.getAllClientIds()};
+    ASSERT_EQ(clientIds.size(), 1);
+    clientId = clientIds[0];
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Pass raw data to data workers (positive)
+// Steps:      Set data workers on server and client, send messages in both directions
+// Exp Result: All data is passed unchanged to the data workers, the forward stream of the client stays empty
+// ====================================================================================================================
+TEST_F(Continuous_TcpConnection_Test_DataWorker, PosTest_DataWorker)
+{
+    tcpServer.setWorkOnData([this](const int id, const char *data, const size_t len)
+                            {
+                                lock_guard<mutex> lck{data_m};
+                                EXPECT_EQ(id, clientId);
+                                dataServer.append(data, len);
+                                callsServer += 1; });
+    tcpClient.setWorkOnData([this](const char *data, const size_t len)
+                            {
+                                lock_guard<mutex> lck{data_m};
+                                dataClient.append(data, len);
+                                callsClient += 1; });
+    connect();
+
+    // Send messages in both directions
+    for (const char *msg : {"Hello", " data", " worker"})
+    {
+        ASSERT_TRUE(tcpClient.sendMsg(msg));
+        ASSERT_TRUE(tcpServer.sendMsg(clientId, msg));
+        this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    }
+
+    // Check data received by data workers
+    lock_guard<mutex> lck{data_m};
+    EXPECT_EQ(dataServer, "Hello data worker");
+    EXPECT_EQ(dataClient, "Hello data worker");
+    EXPECT_EQ(streamClient.str(), "");
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Pass raw data to data workers in batches (positive)
+// Steps:      Set data workers with a batch size of 256 KB, send large messages in both directions
+// Exp Result: All data is passed unchanged and in order, no data is held back when the transfer ends
+// ====================================================================================================================
+TEST_F(Continuous_TcpConnection_Test_DataWorker, PosTest_DataWorkerBatched)
+{
+    tcpServer.setWorkOnData([this](const int, const char *data, const size_t len)
+                            {
+                                lock_guard<mutex> lck{data_m};
+                                dataServer.append(data, len);
+                                callsServer += 1; },
+                            262144);
+    tcpClient.setWorkOnData([this](const char *data, const size_t len)
+                            {
+                                lock_guard<mutex> lck{data_m};
+                                dataClient.append(data, len);
+                                callsClient += 1; },
+                            262144);
+    connect();
+
+    // Create large message with changing content, so the order can be checked
+    string msg;
+    for (size_t i{0}; msg.size() < 4000000; i += 1)
+        msg += to_string(i) + ",";
+
+    // Send messages in both directions
+    ASSERT_TRUE(tcpClient.sendMsg(msg));
+    ASSERT_TRUE(tcpServer.sendMsg(clientId, msg));
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    ASSERT_TRUE(tcpClient.sendMsg("End"));
+    ASSERT_TRUE(tcpServer.sendMsg(clientId, "End"));
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+
+    // Check data received by data workers (Also the last small message is passed without waiting for a full batch)
+    lock_guard<mutex> lck{data_m};
+    EXPECT_EQ(dataServer, msg + "End");
+    EXPECT_EQ(dataClient, msg + "End");
+    EXPECT_GE(callsServer, 2);
+    EXPECT_GE(callsClient, 2);
+
+    return;
+}
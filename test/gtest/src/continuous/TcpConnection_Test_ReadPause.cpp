@@ -0,0 +1,199 @@
+#include <chrono>
+#include <thread>
+#include <future>
+#include <vector>
+#include <string>
+
+#include "continuous/TcpConnection_Test_ReadPause.h"
+#include "HelperFunctions.h"
+
+using namespace std;
+using namespace Test;
+using namespace tcp;
+
+Continuous_TcpConnection_Test_ReadPause::Continuous_TcpConnection_Test_ReadPause() {}
+Continuous_TcpConnection_Test_ReadPause::~Continuous_TcpConnection_Test_ReadPause() {}
+
+void Continuous_TcpConnection_Test_ReadPause::SetUp()
+{
+    // Get free TCP port
+    port = HelperFunctions::getFreePort();
+    ASSERT_NE(port, -1) << "No free port found";
+
+    // Collect received data
+    tcpServer.setWorkOnData([this](const int, const char *data, const size_t len)
+                            {
+                                lock_guard<mutex> lck{data_m};
+                                dataServer.append(data, len); });
+    tcpClient.setWorkOnData([this](const char *data, const size_t len)
+                            {
+                                lock_guard<mutex> lck{data_m};
+                                dataClient.append(data, len); });
+
+    // Start TCP server and connect client
+    ASSERT_EQ(tcpServer.start(port), SERVER_START_OK) << "Unable to start TCP server on port " << port;
+    ASSERT_EQ(tcpClient.start("localhost", port), CLIENT_START_OK) << "Unable to connect TCP client to localhost on port " << port;
+
+    // Wait for connection to be established
+    for (int i{0}; i < 100 && tcpServer.getAllClientIds().empty(); i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+    vector<int> clientIds{tcpServer.getAllClientIds()};
+    ASSERT_EQ(clientIds.size(), 1);
+    clientId = clientIds[0];
+
+    return;
+}
+
+void Continuous_TcpConnection_Test_ReadPause::TearDown()
+{
+    // Stop TCP client and server
+    tcpClient.stop();
+    tcpServer.stop();
+
+    // Check if no pipe error occurred
+    EXPECT_FALSE(HelperFunctions::getAndResetPipeError()) << "Pipe error occurred!";
+
+    return;
+}
+
+size_t Continuous_TcpConnection_Test_ReadPause::getReceivedServer()
+{
+    lock_guard<mutex> lck{data_m};
+    return dataServer.size();
+}
+
+size_t Continuous_TcpConnection_Test_ReadPause::getReceivedClient()
+{
+    lock_guard<mutex> lck{data_m};
+    return dataClient.size();
+}
+
+// ====================================================================================================================
+// Desc:       Pause reading on server (positive)
+// Steps:      Pause reading from client, send a large message from client, resume reading
+// Exp Result: While paused, the sending client is throttled and the server doesn't get all data
+//             After resuming, all data is received unchanged
+// ====================================================================================================================
+TEST_F(Continuous_TcpConnection_Test_ReadPause, PosTest_ServerPauseReading)
+{
+    ASSERT_TRUE(tcpServer.pauseReading(clientId));
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+
+    // Send more data than fits into the socket buffers in the background
+    const string msg(64 * 1024 * 1024, 'x');
+    future<bool> sent{async(launch::async, [this, &msg]()
+                            { return tcpClient.sendMsg(msg); })};
+
+    // Sending client is throttled
+    EXPECT_EQ(sent.wait_for(TestConstants::WAITFOR_MSG_TCP), future_status::timeout);
+    EXPECT_LT(getReceivedServer(), msg.size());
+
+    // After resuming all data is received
+    ASSERT_TRUE(tcpServer.resumeReading(clientId));
+    EXPECT_TRUE(sent.get());
+    for (int i{0}; i < 100 && getReceivedServer() < msg.size(); i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    lock_guard<mutex> lck{data_m};
+    EXPECT_EQ(dataServer, msg);
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Pause reading on client (positive)
+// Steps:      Pause reading from server, send two messages from server, resume reading
+// Exp Result: The first message completes the read already waiting, the second one is received only after resuming
+// ====================================================================================================================
+TEST_F(Continuous_TcpConnection_Test_ReadPause, PosTest_ClientPauseReading)
+{
+    ASSERT_TRUE(tcpClient.pauseReading());
+
+    // First message is read by the read already waiting, second one is not read while paused
+    ASSERT_TRUE(tcpServer.sendMsg(clientId, "Hello"));
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    ASSERT_TRUE(tcpServer.sendMsg(clientId, " client!"));
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    EXPECT_EQ(getReceivedClient(), 5);
+
+    // Message is read after resuming
+    ASSERT_TRUE(tcpClient.resumeReading());
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    lock_guard<mutex> lck{data_m};
+    EXPECT_EQ(dataClient, "Hello client!");
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Pause reading from the data worker (positive)
+// Steps:      Data worker pauses reading after each call (would block), resume from test thread
+// Exp Result: Each resume lets exactly the pending data through, all data is received unchanged
+// ====================================================================================================================
+TEST_F(Continuous_TcpConnection_Test_ReadPause, PosTest_PauseFromDataWorker)
+{
+    tcpServer.setWorkOnData([this](const int id, const char *data, const size_t len)
+                            {
+                                {
+                                    lock_guard<mutex> lck{data_m};
+                                    dataServer.append(data, len);
+                                }
+                                tcpServer.pauseReading(id); });
+
+    // Reconnect, so the new data worker is used
+    tcpClient.stop();
+    ASSERT_EQ(tcpClient.start("localhost", port), CLIENT_START_OK);
+    for (int i{0}; i < 100 && 1 != tcpServer.getAllClientIds().size(); i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+    ASSERT_EQ(tcpServer.getAllClientIds().size(), 1);
+    clientId = tcpServer.getAllClientIds()[0];
+
+    // First message is read, then the worker pauses reading
+    ASSERT_TRUE(tcpClient.sendMsg("Hello"));
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    ASSERT_TRUE(tcpClient.sendMsg(" server!"));
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    {
+        lock_guard<mutex> lck{data_m};
+        EXPECT_EQ(dataServer, "Hello");
+    }
+
+    // Second message is read after resuming
+    ASSERT_TRUE(tcpServer.resumeReading(clientId));
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    lock_guard<mutex> lck{data_m};
+    EXPECT_EQ(dataServer, "Hello server!");
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Stop while reading is paused (positive)
+// Steps:      Pause reading on server and client, stop both
+// Exp Result: Stopping doesn't block on the paused receive threads
+// ====================================================================================================================
+TEST_F(Continuous_TcpConnection_Test_ReadPause, PosTest_StopWhilePaused)
+{
+    ASSERT_TRUE(tcpServer.pauseReading(clientId));
+    ASSERT_TRUE(tcpClient.pauseReading());
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+
+    future<void> stopped{async(launch::async, [this]()
+                               { tcpClient.stop();
+                                 tcpServer.stop(); })};
+    EXPECT_EQ(stopped.wait_for(chrono::seconds{5}), future_status::ready);
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Pause reading of a client that is not connected (negative)
+// Steps:      Pause and resume reading of an unknown client ID
+// Exp Result: false is returned
+// ====================================================================================================================
+TEST_F(Continuous_TcpConnection_Test_ReadPause, NegTest_UnknownClient)
+{
+    EXPECT_FALSE(tcpServer.pauseReading(clientId + 1000));
+    EXPECT_FALSE(tcpServer.resumeReading(clientId + 1000));
+
+    return;
+}
@@ -0,0 +1,162 @@
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "continuous/TcpConnection_Test_Splice.h"
+#include "HelperFunctions.h"
+
+using namespace std;
+using namespace Test;
+using namespace tcp;
+
+Continuous_TcpConnection_Test_Splice::Continuous_TcpConnection_Test_Splice() {}
+Continuous_TcpConnection_Test_Splice::~Continuous_TcpConnection_Test_Splice() {}
+
+void Continuous_TcpConnection_Test_Splice::SetUp()
+{
+    // Get free TCP port
+    port = HelperFunctions::getFreePort();
+    ASSERT_NE(port, -1) << "No free port found";
+
+    // Create empty files used as splice targets
+    char pathServer_c[]{"/tmp/tcp_splice_server_XXXXXX"};
+    char pathClient_c[]{"/tmp/tcp_splice_client_XXXXXX"};
+    const int fdServer{mkstemp(pathServer_c)};
+    const int fdClient{mkstemp(pathClient_c)};
+    ASSERT_NE(fdServer, -1);
+    ASSERT_NE(fdClient, -1);
+    close(fdServer);
+    close(fdClient);
+    pathServer = pathServer_c;
+    pathClient = pathClient_c;
+
+    return;
+}
+
+void Continuous_TcpConnection_Test_Splice::TearDown()
+{
+    // Stop TCP client and server
+    tcpClient.stop();
+    tcpServer.stop();
+
+    // Remove files
+    unlink(pathServer.c_str());
+    unlink(pathClient.c_str());
+
+    // Check if no pipe error occurred
+    EXPECT_FALSE(HelperFunctions::getAndResetPipeError()) << "Pipe error occurred!";
+
+    return;
+}
+
+void Continuous_TcpConnection_Test_Splice::connect()
+{
+    // Start TCP server and connect client
+    ASSERT_EQ(tcpServer.start(port), SERVER_START_OK) << "Unable to start TCP server on port " << port;
+    ASSERT_EQ(tcpClient.start("localhost", port), CLIENT_START_OK) << "Unable to connect TCP client to localhost on port " << port;
+
+    // Wait for connection to be established
+    for (int i{0}; i < 100 && tcpServer.getAllClientIds().empty(); i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+    vector<int> clientIds{tcpServer.getAllClientIds()};
+    ASSERT_EQ(clientIds.size(), 1);
+    clientId = clientIds[0];
+
+    return;
+}
+
+string Continuous_TcpConnection_Test_Splice::readFile(const string &path)
+{
+    ifstream file{path, ios::binary};
+    stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+// ====================================================================================================================
+// Desc:       Splice incoming data to files (positive)
+// Steps:      Set splice targets on server and client, send data in both directions
+// Exp Result: All data is written to the files unchanged, all bytes are spliced, the forward stream stays empty
+// ====================================================================================================================
+TEST_F(Continuous_TcpConnection_Test_Splice, PosTest_SpliceToFile)
+{
+    tcpServer.setCreateSpliceTarget([this](const int)
+                                    { return open(pathServer.c_str(), O_WRONLY | O_CLOEXEC); });
+    const int fdClient{open(pathClient.c_str(), O_WRONLY | O_CLOEXEC)};
+    ASSERT_NE(fdClient, -1);
+    tcpClient.setSpliceTarget(fdClient);
+    connect();
+
+    // Send large data in both directions
+    const string msg(1000000, 'x');
+    ASSERT_TRUE(tcpClient.sendMsg(msg));
+    ASSERT_TRUE(tcpServer.sendMsg(clientId, msg));
+    ASSERT_TRUE(tcpClient.sendMsg("End"));
+    ASSERT_TRUE(tcpServer.sendMsg(clientId, "End"));
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+
+    // Check files and counters
+    EXPECT_EQ(readFile(pathServer), msg + "End");
+    EXPECT_EQ(readFile(pathClient), msg + "End");
+    EXPECT_EQ(tcpServer.getSpliceStats().splicedBytes, msg.size() + 3);
+    EXPECT_EQ(tcpServer.getSpliceStats().copiedBytes, 0);
+    EXPECT_EQ(tcpClient.getSpliceStats().splicedBytes, msg.size() + 3);
+    EXPECT_EQ(tcpClient.getSpliceStats().copiedBytes, 0);
+    EXPECT_EQ(streamClient.str(), "");
+
+    tcpClient.stop();
+    close(fdClient);
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Fall back to copying if the target doesn't support splicing (positive)
+// Steps:      Set a file opened with O_APPEND as splice target on server, send data
+// Exp Result: All data is written to the file unchanged, the bytes are counted as copied
+// ====================================================================================================================
+TEST_F(Continuous_TcpConnection_Test_Splice, PosTest_FallbackToCopy)
+{
+    tcpServer.setCreateSpliceTarget([this](const int)
+                                    { return open(pathServer.c_str(), O_WRONLY | O_APPEND | O_CLOEXEC); });
+    connect();
+
+    // Send data
+    const string msg(1000000, 'y');
+    ASSERT_TRUE(tcpClient.sendMsg(msg));
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+
+    // Check file and counters
+    EXPECT_EQ(readFile(pathServer), msg);
+    EXPECT_EQ(tcpServer.getSpliceStats().splicedBytes + tcpServer.getSpliceStats().copiedBytes, msg.size());
+    EXPECT_GT(tcpServer.getSpliceStats().copiedBytes, 0);
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       No splice target for a connection (positive)
+// Steps:      Splice target creator returns -1, send data
+// Exp Result: Nothing is spliced
+// ====================================================================================================================
+TEST_F(Continuous_TcpConnection_Test_Splice, PosTest_NoTarget)
+{
+    tcpServer.setCreateSpliceTarget([](const int)
+                                    { return -1; });
+    connect();
+
+    ASSERT_TRUE(tcpClient.sendMsg("Hello"));
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+
+    EXPECT_EQ(tcpServer.getSpliceStats().splicedBytes, 0);
+    EXPECT_EQ(tcpServer.getSpliceStats().copiedBytes, 0);
+    EXPECT_EQ(readFile(pathServer), "");
+
+    return;
+}
@@ -0,0 +1,143 @@
+#include <chrono>
+#include <thread>
+#include <memory>
+#include <vector>
+#include <string>
+#include <pthread.h>
+#include <sched.h>
+
+#include "fragmentation/TcpConnection_Test_Affinity.h"
+#include "HelperFunctions.h"
+
+using namespace std;
+using namespace Test;
+using namespace tcp;
+
+Fragmentation_TcpConnection_Test_Affinity::Fragmentation_TcpConnection_Test_Affinity() {}
+Fragmentation_TcpConnection_Test_Affinity::~Fragmentation_TcpConnection_Test_Affinity() {}
+
+void Fragmentation_TcpConnection_Test_Affinity::SetUp()
+{
+    // Get free TCP port
+    port = HelperFunctions::getFreePort();
+    ASSERT_NE(port, -1) << "No free port found";
+
+    // Collect messages and check the CPUs the workers run on
+    tcpServer.setWorkOnMessage([this](const int, const string msg)
+                               {
+                                   const bool pinned{pinnedToCpu0()};
+                                   lock_guard<mutex> lck{messages_m};
+                                   serverMessages.push_back(msg);
+                                   serverWorkersPinned.push_back(pinned); });
+    tcpClient.setWorkOnMessage([this](const string msg)
+                               {
+                                   const bool pinned{pinnedToCpu0()};
+                                   lock_guard<mutex> lck{messages_m};
+                                   clientMessages.push_back(msg);
+                                   clientWorkersPinned.push_back(pinned); });
+    return;
+}
+
+void Fragmentation_TcpConnection_Test_Affinity::TearDown()
+{
+    // Stop TCP client and server
+    tcpClient.stop();
+    tcpServer.stop();
+
+    // Check if no pipe error occurred
+    EXPECT_FALSE(HelperFunctions::getAndResetPipeError()) << "Pipe error occurred!";
+
+    return;
+}
+
+void Fragmentation_TcpConnection_Test_Affinity::connectAndExchange()
+{
+    ASSERT_EQ(tcpServer.start(port), SERVER_START_OK) << "Unable to start TCP server on port " << port;
+    ASSERT_EQ(tcpClient.start("localhost", port), CLIENT_START_OK);
+    for (int i{0}; i < 100 && tcpServer.getAllClientIds().empty(); i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+    ASSERT_EQ(tcpServer.getAllClientIds().size(), 1);
+
+    ASSERT_TRUE(tcpClient.sendMsg("Hello server"));
+    ASSERT_TRUE(tcpServer.sendMsg(tcpServer.getAllClientIds()[0], "Hello client"));
+    for (int i{0}; i < 100; i += 1)
+    {
+        {
+            lock_guard<mutex> lck{messages_m};
+            if (!serverMessages.empty() && !clientMessages.empty())
+                break;
+        }
+        this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    }
+
+    lock_guard<mutex> lck{messages_m};
+    ASSERT_EQ(serverMessages.size(), 1);
+    ASSERT_EQ(clientMessages.size(), 1);
+    EXPECT_EQ(serverMessages[0], "Hello server");
+    EXPECT_EQ(clientMessages[0], "Hello client");
+    return;
+}
+
+bool Fragmentation_TcpConnection_Test_Affinity::pinnedToCpu0()
+{
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    if (pthread_getaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet))
+        return false;
+    return 1 == CPU_COUNT(&cpuSet) && CPU_ISSET(0, &cpuSet);
+}
+
+// ====================================================================================================================
+// Desc:       Check if the worker threads of server and client are pinned to the configured CPUs
+// Steps:      Pin all threads of server and client to CPU 0 and send a message in each direction
+// Exp Result: Both messages are received by workers running on CPU 0 only
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_Affinity, PosTest_PinnedWorkers)
+{
+    ThreadAffinity affinity;
+    affinity.acceptor = {0};
+    affinity.io = {0};
+    affinity.workers = {0};
+    tcpServer.setThreadAffinity(affinity);
+    tcpClient.setThreadAffinity(affinity);
+    connectAndExchange();
+
+    lock_guard<mutex> lck{messages_m};
+    ASSERT_EQ(serverWorkersPinned.size(), 1);
+    ASSERT_EQ(clientWorkersPinned.size(), 1);
+    EXPECT_TRUE(serverWorkersPinned[0]);
+    EXPECT_TRUE(clientWorkersPinned[0]);
+}
+
+// ====================================================================================================================
+// Desc:       Check if connections following the incoming CPU take their buffers from the pool of their NUMA node
+// Steps:      Enable following the incoming CPU and NUMA local buffers on the server and send a message in each direction
+// Exp Result: Both messages are received and the server buffer pools served the connection
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_Affinity, PosTest_FollowIncomingCpu)
+{
+    ThreadAffinity affinity;
+    affinity.followIncomingCpu = true;
+    affinity.numaLocalBuffers = true;
+    tcpServer.setThreadAffinity(affinity);
+    tcpClient.setThreadAffinity(affinity);
+    connectAndExchange();
+
+    EXPECT_LT(0, tcpServer.getBufferPoolStats().bytesInUse);
+}
+
+// ====================================================================================================================
+// Desc:       Check if the workers of a shared I/O context are pinned to its CPUs
+// Steps:      Attach the client to an I/O context pinned to CPU 0 and send a message in each direction
+// Exp Result: The client message is handled by a worker running on CPU 0 only
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_Affinity, PosTest_PinnedIoContext)
+{
+    shared_ptr<ClientIoContext> ioContext{new ClientIoContext{1, {0}}};
+    tcpClient.setIoContext(ioContext);
+    connectAndExchange();
+
+    lock_guard<mutex> lck{messages_m};
+    ASSERT_EQ(clientWorkersPinned.size(), 1);
+    EXPECT_TRUE(clientWorkersPinned[0]);
+}
@@ -0,0 +1,142 @@
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string>
+
+#include "fragmentation/TcpConnection_Test_BusyPoll.h"
+#include "HelperFunctions.h"
+
+using namespace std;
+using namespace Test;
+using namespace tcp;
+
+Fragmentation_TcpConnection_Test_BusyPoll::Fragmentation_TcpConnection_Test_BusyPoll() {}
+Fragmentation_TcpConnection_Test_BusyPoll::~Fragmentation_TcpConnection_Test_BusyPoll() {}
+
+void Fragmentation_TcpConnection_Test_BusyPoll::SetUp()
+{
+    // Get free TCP port
+    port = HelperFunctions::getFreePort();
+    ASSERT_NE(port, -1) << "No free port found";
+
+    // Collect messages in order of arrival
+    tcpServer.setInlineMessageWork(true);
+    tcpClient.setInlineMessageWork(true);
+    tcpServer.setWorkOnMessage([this](const int, const string msg)
+                               {
+                                   lock_guard<mutex> lck{messages_m};
+                                   serverMessages.push_back(msg); });
+    tcpClient.setWorkOnMessage([this](const string msg)
+                               {
+                                   lock_guard<mutex> lck{messages_m};
+                                   clientMessages.push_back(msg); });
+    return;
+}
+
+void Fragmentation_TcpConnection_Test_BusyPoll::TearDown()
+{
+    // Stop TCP client and server
+    tcpClient.stop();
+    tcpServer.stop();
+
+    // Check if no pipe error occurred
+    EXPECT_FALSE(HelperFunctions::getAndResetPipeError()) << "Pipe error occurred!";
+
+    return;
+}
+
+void Fragmentation_TcpConnection_Test_BusyPoll::connect()
+{
+    ASSERT_EQ(tcpServer.start(port), SERVER_START_OK) << "Unable to start TCP server on port " << port;
+    ASSERT_EQ(tcpClient.start("localhost", port), CLIENT_START_OK);
+    for (int i{0}; i < 100 && tcpServer.getAllClientIds().empty(); i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+    ASSERT_EQ(tcpServer.getAllClientIds().size(), 1);
+    return;
+}
+
+void Fragmentation_TcpConnection_Test_BusyPoll::exchangeMessages(const size_t count)
+{
+    const int clientId{tcpServer.getAllClientIds()[0]};
+    for (size_t i{0}; i < count; i += 1)
+    {
+        ASSERT_TRUE(tcpClient.sendMsg("To server " + to_string(i)));
+        ASSERT_TRUE(tcpServer.sendMsg(clientId, "To client " + to_string(i)));
+    }
+
+    // Wait for all messages
+    for (int i{0}; i < 100; i += 1)
+    {
+        {
+            lock_guard<mutex> lck{messages_m};
+            if (serverMessages.size() >= count && clientMessages.size() >= count)
+                break;
+        }
+        this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    }
+
+    lock_guard<mutex> lck{messages_m};
+    ASSERT_EQ(serverMessages.size(), count);
+    ASSERT_EQ(clientMessages.size(), count);
+    for (size_t i{0}; i < count; i += 1)
+    {
+        EXPECT_EQ(serverMessages[i], "To server " + to_string(i));
+        EXPECT_EQ(clientMessages[i], "To client " + to_string(i));
+    }
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Check if messages are transferred with busy poll on both sides
+// Steps:      Enable busy poll on server and client (Pinned to CPU 0) and send 500 messages in each direction
+// Exp Result: All messages are received in order
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_BusyPoll, PosTest_BothDirections)
+{
+    tcpServer.setBusyPoll(BusyPollPolicy{chrono::microseconds{100}, {0}});
+    tcpClient.setBusyPoll(BusyPollPolicy{chrono::microseconds{100}, {0}});
+    connect();
+    exchangeMessages(500);
+}
+
+// ====================================================================================================================
+// Desc:       Check if an idle connection falls back to blocking reads after the budget
+// Steps:      Enable busy poll on both sides, wait much longer than the budget without data, then send messages
+// Exp Result: All messages are received in order
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_BusyPoll, PosTest_IdleConnection)
+{
+    tcpServer.setBusyPoll(BusyPollPolicy{chrono::microseconds{100}, {}});
+    tcpClient.setBusyPoll(BusyPollPolicy{chrono::microseconds{100}, {}});
+    connect();
+    this_thread::sleep_for(chrono::milliseconds{200});
+    exchangeMessages(10);
+}
+
+// ====================================================================================================================
+// Desc:       Check if busy poll works if the receive threads can't be pinned
+// Steps:      Enable busy poll with a CPU that doesn't exist and send messages in both directions
+// Exp Result: All messages are received in order
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_BusyPoll, PosTest_InvalidCpu)
+{
+    tcpServer.setBusyPoll(BusyPollPolicy{chrono::microseconds{100}, {100000}});
+    tcpClient.setBusyPoll(BusyPollPolicy{chrono::microseconds{100}, {100000}});
+    connect();
+    exchangeMessages(10);
+}
+
+// ====================================================================================================================
+// Desc:       Check if busy poll can be disabled again
+// Steps:      Enable and disable busy poll on both sides and send messages in both directions
+// Exp Result: All messages are received in order
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_BusyPoll, PosTest_Disabled)
+{
+    tcpServer.setBusyPoll(BusyPollPolicy{});
+    tcpClient.setBusyPoll(BusyPollPolicy{});
+    tcpServer.disableBusyPoll();
+    tcpClient.disableBusyPoll();
+    connect();
+    exchangeMessages(10);
+}
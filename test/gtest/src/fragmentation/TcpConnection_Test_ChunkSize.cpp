@@ -0,0 +1,250 @@
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string>
+#include <atomic>
+#include <memory_resource>
+
+#include "fragmentation/TcpConnection_Test_ChunkSize.h"
+#include "HelperFunctions.h"
+
+using namespace std;
+using namespace Test;
+using namespace tcp;
+
+Fragmentation_TcpConnection_Test_ChunkSize::Fragmentation_TcpConnection_Test_ChunkSize() {}
+Fragmentation_TcpConnection_Test_ChunkSize::~Fragmentation_TcpConnection_Test_ChunkSize() {}
+
+void Fragmentation_TcpConnection_Test_ChunkSize::SetUp()
+{
+    // Buffer incoming messages on server and client
+    tcpServer.setWorkOnMessage([this](const int, const string msg)
+                               {
+                                   lock_guard<mutex> lck{messages_m};
+                                   messagesOnServer.push_back(msg); });
+    tcpClient.setWorkOnMessage([this](const string msg)
+                               {
+                                   lock_guard<mutex> lck{messages_m};
+                                   messagesOnClient.push_back(msg); });
+
+    // Get free TCP port
+    port = HelperFunctions::getFreePort();
+    ASSERT_NE(port, -1) << "No free port found";
+
+    return;
+}
+
+void Fragmentation_TcpConnection_Test_ChunkSize::TearDown()
+{
+    // Stop TCP client and server
+    tcpClient.stop();
+    tcpServer.stop();
+
+    // Check if no pipe error occurred
+    EXPECT_FALSE(HelperFunctions::getAndResetPipeError()) << "Pipe error occurred!";
+
+    return;
+}
+
+void Fragmentation_TcpConnection_Test_ChunkSize::connect()
+{
+    // Start TCP server and connect client
+    ASSERT_EQ(tcpServer.start(port), SERVER_START_OK) << "Unable to start TCP server on port " << port;
+    ASSERT_EQ(tcpClient.start("localhost", port), CLIENT_START_OK) << "Unable to connect TCP client to localhost on port " << port;
+
+    // Wait for connection to be established
+    this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+
+    // Get client ID
+    vector<int> clientIds{tcpServer.getAllClientIds()};
+    ASSERT_EQ(clientIds.size(), 1);
+    clientId = clientIds[0];
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Transfer messages with a fixed receive chunk size smaller than the messages (positive)
+// Steps:      Set receive chunk size to 7 bytes, send long and short messages in both directions
+// Exp Result: All messages are reassembled correctly
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_ChunkSize, PosTest_FixedChunkSize)
+{
+    // Set small receive chunk size and connect
+    tcpServer.setReceiveChunkSize(7);
+    tcpClient.setReceiveChunkSize(7);
+    ASSERT_NO_FATAL_FAILURE(connect());
+
+    // Send messages in both directions
+    const string msgLong(1000, 'x');
+    ASSERT_TRUE(tcpClient.sendMsg(msgLong));
+    ASSERT_TRUE(tcpClient.sendMsg("Hi"));
+    ASSERT_TRUE(tcpServer.sendMsg(clientId, msgLong));
+    ASSERT_TRUE(tcpServer.sendMsg(clientId, "Hi"));
+
+    // Wait for messages to be received
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+
+    // Check received messages
+    lock_guard<mutex> lck{messages_m};
+    EXPECT_EQ(messagesOnServer, (vector<string>{msgLong, "Hi"}));
+    EXPECT_EQ(messagesOnClient, (vector<string>{msgLong, "Hi"}));
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Transfer messages with an adaptive receive chunk size (positive)
+// Steps:      Set adaptive receive chunk size (16 bytes to 64 KB), send large messages followed by many small ones
+// Exp Result: All messages are reassembled correctly while the buffer grows and shrinks
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_ChunkSize, PosTest_AdaptiveChunkSize)
+{
+    // Set adaptive receive chunk size and connect
+    tcpServer.setReceiveChunkSizeAdaptive(16, 65536);
+    tcpClient.setReceiveChunkSizeAdaptive(16, 65536);
+    ASSERT_NO_FATAL_FAILURE(connect());
+
+    // Send large messages, then small messages one by one
+    vector<string> messagesExpected;
+    for (int i{0}; i < 3; i += 1)
+    {
+        messagesExpected.push_back(string(200000, static_cast<char>('a' + i)));
+        ASSERT_TRUE(tcpClient.sendMsg(messagesExpected.back()));
+        ASSERT_TRUE(tcpServer.sendMsg(clientId, messagesExpected.back()));
+    }
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_LONG_TCP);
+    for (int i{0}; i < 50; i += 1)
+    {
+        messagesExpected.push_back(to_string(i));
+        ASSERT_TRUE(tcpClient.sendMsg(messagesExpected.back()));
+        ASSERT_TRUE(tcpServer.sendMsg(clientId, messagesExpected.back()));
+        this_thread::sleep_for(chrono::milliseconds(1));
+    }
+
+    // Wait for messages to be received
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+
+    // Check received messages
+    lock_guard<mutex> lck{messages_m};
+    EXPECT_EQ(messagesOnServer, messagesExpected);
+    EXPECT_EQ(messagesOnClient, messagesExpected);
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Set invalid receive chunk sizes (negative)
+// Steps:      Set chunk size 0 and adaptive bounds with minimum above maximum
+// Exp Result: Exceptions are thrown
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_ChunkSize, NegTest_InvalidChunkSize)
+{
+    EXPECT_THROW(tcpServer.setReceiveChunkSize(0), Server_error);
+    EXPECT_THROW(tcpServer.setReceiveChunkSizeAdaptive(1024, 512), Server_error);
+    EXPECT_THROW(tcpClient.setReceiveChunkSize(0), Client_error);
+    EXPECT_THROW(tcpClient.setReceiveChunkSizeAdaptive(1024, 512), Client_error);
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Reuse receive buffers from the buffer pool (positive)
+// Steps:      Connect, disconnect and connect the client again
+// Exp Result: Buffer of the first connection is returned to the pool and reused for the second connection
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_ChunkSize, PosTest_BufferPoolReuse)
+{
+    // Connect and disconnect client
+    ASSERT_NO_FATAL_FAILURE(connect());
+    tcpClient.stop();
+    this_thread::sleep_for(TestConstants::WAITFOR_DISCONNECT_TCP);
+
+    // Check that the buffer is released to the pool
+    BufferPoolStats stats{tcpServer.getBufferPoolStats()};
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(stats.bytesInUse, 0);
+    EXPECT_EQ(stats.bytesCached, DEFAULT_RECEIVE_CHUNK_SIZE);
+
+    // Connect client again
+    ASSERT_EQ(tcpClient.start("localhost", port), CLIENT_START_OK) << "Unable to connect TCP client to localhost on port " << port;
+    this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+
+    // Check that the buffer is reused
+    stats = tcpServer.getBufferPoolStats();
+    EXPECT_EQ(stats.hits, 1);
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(stats.bytesInUse, DEFAULT_RECEIVE_CHUNK_SIZE);
+    EXPECT_EQ(stats.bytesCached, 0);
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Take receive buffers from a custom memory resource (positive)
+// Steps:      Set a counting memory resource on server and client, then connect and transfer a message
+// Exp Result: Receive buffers are allocated from the custom resource and the message is transferred
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_ChunkSize, PosTest_CustomMemoryResource)
+{
+    // Memory resource counting its allocations
+    class CountingResource : public pmr::memory_resource
+    {
+    public:
+        atomic<int> allocations{0};
+
+    protected:
+        void *do_allocate(size_t bytes, size_t alignment) override
+        {
+            allocations += 1;
+            return pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+        void do_deallocate(void *p, size_t bytes, size_t alignment) override
+        {
+            pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+        bool do_is_equal(const pmr::memory_resource &other) const noexcept override
+        {
+            return this == &other;
+        }
+    } serverResource, clientResource;
+
+    // Set memory resources and connect
+    tcpServer.setMemoryResource(&serverResource);
+    tcpClient.setMemoryResource(&clientResource);
+    ASSERT_NO_FATAL_FAILURE(connect());
+
+    // Transfer message
+    ASSERT_TRUE(tcpClient.sendMsg("Hello"));
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+
+    // Check allocations and received message
+    EXPECT_EQ(serverResource.allocations, 1);
+    EXPECT_EQ(clientResource.allocations, 1);
+    lock_guard<mutex> lck{messages_m};
+    EXPECT_EQ(messagesOnServer, (vector<string>{"Hello"}));
+
+    // Stop and reset memory resources here, because the resources are destroyed at the end of this test
+    // Resetting returns the cached buffers to the custom resources
+    tcpClient.stop();
+    tcpServer.stop();
+    tcpServer.setMemoryResource(nullptr);
+    tcpClient.setMemoryResource(nullptr);
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Change memory resource while receive buffers are in use (negative)
+// Steps:      Connect client, then set a memory resource on server and client
+// Exp Result: Exceptions are thrown
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_ChunkSize, NegTest_MemoryResourceInUse)
+{
+    ASSERT_NO_FATAL_FAILURE(connect());
+
+    EXPECT_THROW(tcpServer.setMemoryResource(pmr::new_delete_resource()), Error);
+    EXPECT_THROW(tcpClient.setMemoryResource(pmr::new_delete_resource()), Error);
+
+    return;
+}
@@ -0,0 +1,244 @@
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <string>
+
+#include "fragmentation/TcpConnection_Test_ClientPool.h"
+#include "HelperFunctions.h"
+
+using namespace std;
+using namespace Test;
+using namespace tcp;
+
+Fragmentation_TcpConnection_Test_ClientPool::Fragmentation_TcpConnection_Test_ClientPool() {}
+Fragmentation_TcpConnection_Test_ClientPool::~Fragmentation_TcpConnection_Test_ClientPool() {}
+
+void Fragmentation_TcpConnection_Test_ClientPool::SetUp()
+{
+    // Get free TCP port
+    port = HelperFunctions::getFreePort();
+    ASSERT_NE(port, -1) << "No free port found";
+
+    // Start TCP server
+    ASSERT_EQ(tcpServer.start(port), SERVER_START_OK) << "Unable to start TCP server on port " << port;
+    return;
+}
+
+void Fragmentation_TcpConnection_Test_ClientPool::TearDown()
+{
+    // Stop pools and TCP server
+    roundRobinPool.stop();
+    leastLoadedPool.stop();
+    tcpServer.stop();
+
+    // Check if no pipe error occurred
+    EXPECT_FALSE(HelperFunctions::getAndResetPipeError()) << "Pipe error occurred!";
+
+    return;
+}
+
+unique_ptr<TcpClient_PoolProbe> Fragmentation_TcpConnection_Test_ClientPool::createMember()
+{
+    unique_ptr<TcpClient_PoolProbe> member{new TcpClient_PoolProbe{}};
+    lock_guard<mutex> lck{createdMembers_m};
+    createdMembers.push_back(member.get());
+    return member;
+}
+
+void Fragmentation_TcpConnection_Test_ClientPool::waitForClients(TestApi::TcpServerApi_fragmentation &server, const size_t count)
+{
+    for (int i{0}; i < 100 && server.getClientIds().size() != count; i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+    ASSERT_EQ(server.getClientIds().size(), count);
+    return;
+}
+
+map<int, size_t> Fragmentation_TcpConnection_Test_ClientPool::receiveMessages(const size_t count)
+{
+    map<int, size_t> perClient;
+    size_t received{0};
+    for (int i{0}; i < 50 && received < count; i += 1)
+    {
+        this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+        for (const TestApi::MessageFromClient &it : tcpServer.getBufferedMsg())
+        {
+            perClient[it.id] += 1;
+            received += 1;
+        }
+    }
+    return perClient;
+}
+
+// ====================================================================================================================
+// Desc:       Check if a round robin pool sends with all members in turn
+// Steps:      Start a pool of 4 members and send 40 messages
+// Exp Result: Each member sends 10 messages
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_ClientPool, PosTest_RoundRobin)
+{
+    ASSERT_EQ(roundRobinPool.start("localhost", port, 4), CLIENT_START_OK);
+    EXPECT_TRUE(roundRobinPool.isRunning());
+    EXPECT_EQ(roundRobinPool.getSize(), 4);
+    EXPECT_EQ(roundRobinPool.getConnectedCount(), 4);
+    waitForClients(tcpServer, 4);
+
+    for (int i{0}; i < 40; i += 1)
+        EXPECT_TRUE(roundRobinPool.sendMsg("Message " + to_string(i)));
+
+    const map<int, size_t> perClient{receiveMessages(40)};
+    ASSERT_EQ(perClient.size(), 4);
+    for (const auto &it : perClient)
+        EXPECT_EQ(it.second, 10) << "Client " << it.first;
+}
+
+// ====================================================================================================================
+// Desc:       Check if a least loaded pool sends all messages of many parallel senders
+// Steps:      Start a pool of 4 members and send 100 messages from each of 8 threads at the same time
+// Exp Result: All messages are received, nothing is queued after sending
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_ClientPool, PosTest_LeastLoadedParallel)
+{
+    ASSERT_EQ(leastLoadedPool.start("localhost", port, 4), CLIENT_START_OK);
+    waitForClients(tcpServer, 4);
+
+    vector<thread> senders;
+    atomic<int> failed{0};
+    for (int t{0}; t < 8; t += 1)
+        senders.emplace_back([this, t, &failed]()
+                             {
+                                 for (int i{0}; i < 100; i += 1)
+                                 {
+                                     if (!leastLoadedPool.sendMsg("Sender " + to_string(t) + " message " + to_string(i)))
+                                         failed += 1;
+                                 } });
+    for (auto &it : senders)
+        it.join();
+    EXPECT_EQ(failed, 0);
+
+    size_t received{0};
+    for (const auto &it : receiveMessages(800))
+        received += it.second;
+    EXPECT_EQ(received, 800);
+    EXPECT_EQ(leastLoadedPool.getQueueDepths(), vector<size_t>(4, 0));
+}
+
+// ====================================================================================================================
+// Desc:       Check if a pool can be restarted while messages are sent
+// Steps:      Send messages from 4 threads continuously while the pool of 4 members is stopped and started 5 times
+// Exp Result: Sending doesn't crash, the restarted pool sends and nothing is queued after sending
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_ClientPool, PosTest_RestartWhileSending)
+{
+    ASSERT_EQ(leastLoadedPool.start("localhost", port, 4), CLIENT_START_OK);
+    waitForClients(tcpServer, 4);
+
+    vector<thread> senders;
+    atomic<bool> sending{true};
+    for (int t{0}; t < 4; t += 1)
+        senders.emplace_back([this, &sending]()
+                             {
+                                 while (sending)
+                                     leastLoadedPool.sendMsg("Hello"); });
+    for (int i{0}; i < 5; i += 1)
+    {
+        leastLoadedPool.stop();
+        EXPECT_EQ(leastLoadedPool.start("localhost", port, 4), CLIENT_START_OK);
+    }
+    sending = false;
+    for (auto &it : senders)
+        it.join();
+
+    EXPECT_TRUE(leastLoadedPool.sendMsg("Hello"));
+    EXPECT_EQ(leastLoadedPool.getQueueDepths(), vector<size_t>(4, 0));
+}
+
+// ====================================================================================================================
+// Desc:       Check if a least loaded pool spreads sequential sends over all members
+// Steps:      Start a pool of 3 members and send 30 messages one after another
+// Exp Result: Each member sends 10 messages (Members take turns on equal load)
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_ClientPool, PosTest_LeastLoadedEqualLoad)
+{
+    ASSERT_EQ(leastLoadedPool.start("localhost", port, 3), CLIENT_START_OK);
+    waitForClients(tcpServer, 3);
+
+    for (int i{0}; i < 30; i += 1)
+        EXPECT_TRUE(leastLoadedPool.sendMsg("Message " + to_string(i)));
+
+    const map<int, size_t> perClient{receiveMessages(30)};
+    ASSERT_EQ(perClient.size(), 3);
+    for (const auto &it : perClient)
+        EXPECT_EQ(it.second, 10) << "Client " << it.first;
+}
+
+// ====================================================================================================================
+// Desc:       Check if a lost member is replaced in the background
+// Steps:      Start a pool of 3 members, drop the connection of one member and send messages
+// Exp Result: Sending goes on with the other members, the lost member is replaced by a new connection
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_ClientPool, PosTest_ReplaceLost)
+{
+    roundRobinPool.setReplaceInterval(chrono::milliseconds{20});
+    ASSERT_EQ(roundRobinPool.start("localhost", port, 3), CLIENT_START_OK);
+    waitForClients(tcpServer, 3);
+
+    {
+        lock_guard<mutex> lck{createdMembers_m};
+        createdMembers[0]->dropConnection();
+    }
+    for (int i{0}; i < 100 && 0 == roundRobinPool.getReplacedCount(); i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+    EXPECT_EQ(roundRobinPool.getReplacedCount(), 1);
+    EXPECT_EQ(roundRobinPool.getConnectedCount(), 3);
+    waitForClients(tcpServer, 3);
+
+    for (int i{0}; i < 30; i += 1)
+        EXPECT_TRUE(roundRobinPool.sendMsg("Message " + to_string(i)));
+    const map<int, size_t> perClient{receiveMessages(30)};
+    ASSERT_EQ(perClient.size(), 3);
+    for (const auto &it : perClient)
+        EXPECT_EQ(it.second, 10) << "Client " << it.first;
+}
+
+// ====================================================================================================================
+// Desc:       Check if the members of a pool are spread over several servers
+// Steps:      Start a second server and a pool of 4 members connecting to both servers
+// Exp Result: Each server gets 2 members and half of the messages
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_ClientPool, PosTest_MultipleEndpoints)
+{
+    TestApi::TcpServerApi_fragmentation secondServer;
+    const int secondPort{HelperFunctions::getFreePort()};
+    ASSERT_NE(secondPort, -1) << "No free port found";
+    ASSERT_EQ(secondServer.start(secondPort), SERVER_START_OK);
+
+    ASSERT_EQ(roundRobinPool.start({{"localhost", port}, {"localhost", secondPort}}, 4), CLIENT_START_OK);
+    waitForClients(tcpServer, 2);
+    waitForClients(secondServer, 2);
+
+    for (int i{0}; i < 20; i += 1)
+        EXPECT_TRUE(roundRobinPool.sendMsg("Message " + to_string(i)));
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    EXPECT_EQ(tcpServer.getBufferedMsg().size(), 10);
+    EXPECT_EQ(secondServer.getBufferedMsg().size(), 10);
+
+    roundRobinPool.stop();
+    secondServer.stop();
+}
+
+// ====================================================================================================================
+// Desc:       Check if a pool doesn't start without any server
+// Steps:      Start a pool to a port no server listens on and send a message
+// Exp Result: Connection error, pool is not running and can't send
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_ClientPool, NegTest_NoServer)
+{
+    const int unusedPort{HelperFunctions::getFreePort()};
+    ASSERT_NE(unusedPort, -1) << "No free port found";
+    EXPECT_EQ(roundRobinPool.start("localhost", unusedPort, 2), CLIENT_ERROR_START_CONNECT);
+    EXPECT_FALSE(roundRobinPool.isRunning());
+    EXPECT_EQ(roundRobinPool.getSize(), 0);
+    EXPECT_FALSE(roundRobinPool.sendMsg("Nobody listens"));
+    EXPECT_EQ(roundRobinPool.start("localhost", port, 0), -1);
+}
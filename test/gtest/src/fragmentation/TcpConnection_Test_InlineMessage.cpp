@@ -0,0 +1,66 @@
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string>
+
+#include "fragmentation/TcpConnection_Test_InlineMessage.h"
+#include "HelperFunctions.h"
+
+using namespace std;
+using namespace Test;
+using namespace tcp;
+
+Fragmentation_TcpConnection_Test_InlineMessage::Fragmentation_TcpConnection_Test_InlineMessage() {}
+Fragmentation_TcpConnection_Test_InlineMessage::~Fragmentation_TcpConnection_Test_InlineMessage() {}
+
+void Fragmentation_TcpConnection_Test_InlineMessage::SetUp()
+{
+    // Get free TCP port
+    port = HelperFunctions::getFreePort();
+    ASSERT_NE(port, -1) << "No free port found";
+
+    // Start TCP server and connect client
+    ASSERT_EQ(tcpServer.start(port), SERVER_START_OK) << "Unable to start TCP server on port " << port;
+    ASSERT_EQ(tcpClient.start("localhost", port), CLIENT_START_OK) << "Unable to connect TCP client to localhost on port " << port;
+
+    // Wait for connection to be established
+    this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+
+    return;
+}
+
+void Fragmentation_TcpConnection_Test_InlineMessage::TearDown()
+{
+    // Stop TCP client and server
+    tcpClient.stop();
+    tcpServer.stop();
+
+    // Check if no pipe error occurred
+    EXPECT_FALSE(HelperFunctions::getAndResetPipeError()) << "Pipe error occurred!";
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Receive messages with inline storage chosen by the handler policy (positive)
+// Steps:      Send messages up to and beyond the inline capacity of 64 bytes
+// Exp Result: Messages up to 64 bytes are stored inline, larger ones on the heap, all are received unchanged
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_InlineMessage, PosTest_InlineAndHeapMessages)
+{
+    // Send messages of different sizes one by one (Each one is handed to its own work thread)
+    const vector<string> messagesExpected{"Hello", string(64, 'a'), string(65, 'b'), string(100000, 'c')};
+    for (const string &msg : messagesExpected)
+    {
+        ASSERT_TRUE(tcpClient.sendMsg(msg));
+        this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    }
+
+    // Check received messages and their storage
+    InlineHandler &handler{tcpServer.getHandler()};
+    lock_guard<mutex> lck{handler.messages_m};
+    EXPECT_EQ(handler.messages, messagesExpected);
+    EXPECT_EQ(handler.messagesInline, (vector<bool>{true, true, false, false}));
+
+    return;
+}
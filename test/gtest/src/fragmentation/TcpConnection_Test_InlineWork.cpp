@@ -0,0 +1,139 @@
+#include <chrono>
+#include <thread>
+#include <future>
+#include <vector>
+#include <string>
+
+#include "fragmentation/TcpConnection_Test_InlineWork.h"
+#include "HelperFunctions.h"
+
+using namespace std;
+using namespace Test;
+using namespace tcp;
+
+Fragmentation_TcpConnection_Test_InlineWork::Fragmentation_TcpConnection_Test_InlineWork() {}
+Fragmentation_TcpConnection_Test_InlineWork::~Fragmentation_TcpConnection_Test_InlineWork() {}
+
+void Fragmentation_TcpConnection_Test_InlineWork::SetUp()
+{
+    // Get free TCP port
+    port = HelperFunctions::getFreePort();
+    ASSERT_NE(port, -1) << "No free port found";
+
+    // Collect messages and the threads the workers run in
+    tcpServer.setWorkOnMessage([this](const int, const string msg)
+                               {
+                                   lock_guard<mutex> lck{messages_m};
+                                   serverMessages.push_back(msg);
+                                   workerThreads.insert(this_thread::get_id()); });
+    tcpClient.setWorkOnMessage([this](const string msg)
+                               {
+                                   lock_guard<mutex> lck{messages_m};
+                                   clientMessages.push_back(msg);
+                                   workerThreads.insert(this_thread::get_id()); });
+    return;
+}
+
+void Fragmentation_TcpConnection_Test_InlineWork::TearDown()
+{
+    // Stop TCP client and server
+    tcpClient.stop();
+    tcpServer.stop();
+
+    // Check if no pipe error occurred
+    EXPECT_FALSE(HelperFunctions::getAndResetPipeError()) << "Pipe error occurred!";
+
+    return;
+}
+
+void Fragmentation_TcpConnection_Test_InlineWork::connect()
+{
+    ASSERT_EQ(tcpServer.start(port), SERVER_START_OK) << "Unable to start TCP server on port " << port;
+    ASSERT_EQ(tcpClient.start("localhost", port), CLIENT_START_OK);
+    for (int i{0}; i < 100 && tcpServer.getAllClientIds().empty(); i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+    ASSERT_EQ(tcpServer.getAllClientIds().size(), 1);
+    return;
+}
+
+void Fragmentation_TcpConnection_Test_InlineWork::waitForMessages(const vector<string> &messages, const size_t count)
+{
+    for (int i{0}; i < 100; i += 1)
+    {
+        {
+            lock_guard<mutex> lck{messages_m};
+            if (messages.size() >= count)
+                return;
+        }
+        this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    }
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Check if the client runs the message worker in its receive thread
+// Steps:      Enable inline message work on the client and send 1000 messages from the server
+// Exp Result: All messages are received in order by one thread
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_InlineWork, PosTest_ClientInline)
+{
+    tcpClient.setInlineMessageWork(true);
+    connect();
+
+    vector<string> expected;
+    const int clientId{tcpServer.getAllClientIds()[0]};
+    for (int i{0}; i < 1000; i += 1)
+    {
+        expected.push_back("Message " + to_string(i));
+        ASSERT_TRUE(tcpServer.sendMsg(clientId, expected.back()));
+    }
+    waitForMessages(clientMessages, 1000);
+
+    lock_guard<mutex> lck{messages_m};
+    EXPECT_EQ(clientMessages, expected);
+    EXPECT_EQ(workerThreads.size(), 1);
+}
+
+// ====================================================================================================================
+// Desc:       Check if the server runs the message worker in the receive thread of the connection
+// Steps:      Enable inline message work on the server and send 1000 messages from the client
+// Exp Result: All messages are received in order by one thread
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_InlineWork, PosTest_ServerInline)
+{
+    tcpServer.setInlineMessageWork(true);
+    connect();
+
+    vector<string> expected;
+    for (int i{0}; i < 1000; i += 1)
+    {
+        expected.push_back("Message " + to_string(i));
+        ASSERT_TRUE(tcpClient.sendMsg(expected.back()));
+    }
+    waitForMessages(serverMessages, 1000);
+
+    lock_guard<mutex> lck{messages_m};
+    EXPECT_EQ(serverMessages, expected);
+    EXPECT_EQ(workerThreads.size(), 1);
+}
+
+// ====================================================================================================================
+// Desc:       Check if requests are answered by an inline request worker
+// Steps:      Enable inline message work on both sides and send requests replied by the server
+// Exp Result: Each request gets its response
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_InlineWork, PosTest_InlineRequest)
+{
+    tcpServer.setInlineMessageWork(true);
+    tcpClient.setInlineMessageWork(true);
+    tcpServer.setWorkOnRequest([this](const int clientId, const uint64_t requestId, const string msg)
+                               { tcpServer.reply(clientId, requestId, "Re: " + msg); });
+    connect();
+
+    for (int i{0}; i < 10; i += 1)
+    {
+        future<string> response{tcpClient.request(to_string(i), chrono::seconds{1})};
+        ASSERT_EQ(response.wait_for(chrono::seconds{2}), future_status::ready);
+        EXPECT_EQ(response.get(), "Re: " + to_string(i));
+    }
+}
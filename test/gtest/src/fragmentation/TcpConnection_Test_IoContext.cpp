@@ -0,0 +1,242 @@
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <string>
+
+#include "fragmentation/TcpConnection_Test_IoContext.h"
+#include "HelperFunctions.h"
+
+using namespace std;
+using namespace Test;
+using namespace tcp;
+
+Fragmentation_TcpConnection_Test_IoContext::Fragmentation_TcpConnection_Test_IoContext() {}
+Fragmentation_TcpConnection_Test_IoContext::~Fragmentation_TcpConnection_Test_IoContext() {}
+
+void Fragmentation_TcpConnection_Test_IoContext::SetUp()
+{
+    // Get free TCP port
+    port = HelperFunctions::getFreePort();
+    ASSERT_NE(port, -1) << "No free port found";
+
+    // Start TCP server
+    ASSERT_EQ(tcpServer.start(port), SERVER_START_OK) << "Unable to start TCP server on port " << port;
+    return;
+}
+
+void Fragmentation_TcpConnection_Test_IoContext::TearDown()
+{
+    // Stop TCP clients and server
+    for (auto &client : tcpClients)
+        client->stop();
+    tcpServer.stop();
+
+    // Check if no pipe error occurred
+    EXPECT_FALSE(HelperFunctions::getAndResetPipeError()) << "Pipe error occurred!";
+
+    return;
+}
+
+void Fragmentation_TcpConnection_Test_IoContext::startClients(const size_t count)
+{
+    received.resize(count);
+    for (size_t i{0}; i < count; i += 1)
+    {
+        tcpClients.emplace_back(new TcpClient{'\x00'});
+        tcpClients.back()->setIoContext(ioContext);
+        tcpClients.back()->setWorkOnMessage([this, i](const string msg)
+                                            {
+                                                lock_guard<mutex> lck{received_m};
+                                                received[i].push_back(msg); });
+        ASSERT_EQ(tcpClients.back()->start("localhost", port), CLIENT_START_OK) << "Unable to connect TCP client " << i;
+    }
+
+    // Wait for all connections to be established
+    for (int i{0}; i < 100 && tcpServer.getAllClientIds().size() < count; i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+    ASSERT_EQ(tcpServer.getAllClientIds().size(), count);
+    return;
+}
+
+vector<string> Fragmentation_TcpConnection_Test_IoContext::getReceived(const size_t client)
+{
+    lock_guard<mutex> lck{received_m};
+    return received[client];
+}
+
+// ====================================================================================================================
+// Desc:       Check if many clients share the workers of one I/O context
+// Steps:      Start 20 clients attached to a context with 2 workers and send a message to each client
+// Exp Result: All clients are attached to the context and each client receives its message
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_IoContext, PosTest_ManyClients)
+{
+    startClients(20);
+    EXPECT_EQ(ioContext->getWorkerCount(), 2);
+    EXPECT_EQ(ioContext->getConnectionCount(), 20);
+
+    for (const int clientId : tcpServer.getAllClientIds())
+        EXPECT_TRUE(tcpServer.sendMsg(clientId, "Hello client " + to_string(clientId)));
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+
+    for (size_t i{0}; i < tcpClients.size(); i += 1)
+        EXPECT_EQ(getReceived(i).size(), 1) << "Client " << i;
+}
+
+// ====================================================================================================================
+// Desc:       Check if messages of one connection are passed in order
+// Steps:      Send 1000 numbered messages to one client attached to the context
+// Exp Result: All messages received in the order they were sent
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_IoContext, PosTest_MessageOrder)
+{
+    startClients(1);
+    const int clientId{tcpServer.getAllClientIds()[0]};
+    for (int i{0}; i < 1000; i += 1)
+        ASSERT_TRUE(tcpServer.sendMsg(clientId, to_string(i)));
+
+    vector<string> messages;
+    for (int i{0}; i < 100 && messages.size() < 1000; i += 1)
+    {
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+        messages = getReceived(0);
+    }
+    ASSERT_EQ(messages.size(), 1000);
+    for (int i{0}; i < 1000; i += 1)
+        EXPECT_EQ(messages[i], to_string(i));
+}
+
+// ====================================================================================================================
+// Desc:       Check if a paused client attached to the context doesn't read until it is resumed
+// Steps:      Pause reading, send a message, resume reading
+// Exp Result: No message while paused, message received after resuming
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_IoContext, PosTest_PauseResume)
+{
+    startClients(1);
+    const int clientId{tcpServer.getAllClientIds()[0]};
+
+    ASSERT_TRUE(tcpClients[0]->pauseReading());
+    EXPECT_TRUE(tcpServer.sendMsg(clientId, "Paused"));
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    EXPECT_TRUE(getReceived(0).empty());
+
+    ASSERT_TRUE(tcpClients[0]->resumeReading());
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    EXPECT_EQ(getReceived(0), vector<string>{"Paused"});
+}
+
+// ====================================================================================================================
+// Desc:       Check if clients leave the context when stopped or the server is stopped
+// Steps:      Stop one of two clients, then stop the server
+// Exp Result: One connection left after stopping the client, none after stopping the server
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_IoContext, PosTest_Detach)
+{
+    startClients(2);
+    EXPECT_EQ(ioContext->getConnectionCount(), 2);
+
+    tcpClients[0]->stop();
+    EXPECT_EQ(ioContext->getConnectionCount(), 1);
+    EXPECT_FALSE(tcpClients[0]->isRunning());
+
+    tcpServer.stop();
+    for (int i{0}; i < 100 && 0 < ioContext->getConnectionCount(); i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+    EXPECT_EQ(ioContext->getConnectionCount(), 0);
+    EXPECT_FALSE(tcpClients[1]->isRunning());
+}
+
+// ====================================================================================================================
+// Desc:       Check if a client attached to the context attaches its new connection after reconnecting
+// Steps:      Enable reconnecting, drop the connection of the client and send a message after reconnecting
+// Exp Result: Client reconnects, is attached again and receives the message
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_IoContext, PosTest_Reconnect)
+{
+    TcpClient_IoContextProbe tcpClient{};
+    ReconnectPolicy policy;
+    policy.initialDelay = chrono::milliseconds{10};
+    tcpClient.setReconnectPolicy(policy);
+    atomic<int> reconnects{0};
+    tcpClient.setWorkOnReconnect([&reconnects](const bool success, const unsigned int)
+                                 {
+                                     if (success)
+                                         reconnects += 1; });
+    vector<string> messages;
+    tcpClient.setWorkOnMessage([this, &messages](const string msg)
+                               {
+                                   lock_guard<mutex> lck{received_m};
+                                   messages.push_back(msg); });
+    tcpClient.setIoContext(ioContext);
+    ASSERT_EQ(tcpClient.start("localhost", port), CLIENT_START_OK);
+
+    tcpClient.dropConnection();
+    for (int i{0}; i < 100 && 0 == reconnects; i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+    ASSERT_EQ(reconnects, 1) << "Client didn't reconnect";
+    EXPECT_EQ(ioContext->getConnectionCount(), 1);
+
+    vector<int> clientIds;
+    for (int i{0}; i < 100 && clientIds.size() != 1; i += 1)
+    {
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+        clientIds = tcpServer.getAllClientIds();
+    }
+    ASSERT_EQ(clientIds.size(), 1);
+    EXPECT_TRUE(tcpServer.sendMsg(clientIds[0], "Reconnected"));
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+
+    tcpClient.stop();
+    EXPECT_EQ(ioContext->getConnectionCount(), 0);
+    lock_guard<mutex> lck{received_m};
+    EXPECT_EQ(messages, vector<string>{"Reconnected"});
+}
+
+// ====================================================================================================================
+// Desc:       Check if a message worker run by the context can stop its own client
+// Steps:      Send a message to a client whose worker stops the client, then start the client again and send a message
+// Exp Result: Client stops and leaves the context without blocking the worker, the restarted client receives the message
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_IoContext, PosTest_StopFromWorker)
+{
+    TcpClient tcpClient{'\x00'};
+    vector<string> messages;
+    tcpClient.setWorkOnMessage([this, &messages, &tcpClient](const string msg)
+                               {
+                                   {
+                                       lock_guard<mutex> lck{received_m};
+                                       messages.push_back(msg);
+                                   }
+                                   if ("Stop" == msg)
+                                       tcpClient.stop(); });
+    tcpClient.setIoContext(ioContext);
+    ASSERT_EQ(tcpClient.start("localhost", port), CLIENT_START_OK);
+    for (int i{0}; i < 100 && tcpServer.getAllClientIds().size() != 1; i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+    ASSERT_EQ(tcpServer.getAllClientIds().size(), 1);
+
+    // Worker stops the client
+    EXPECT_TRUE(tcpServer.sendMsg(tcpServer.getAllClientIds()[0], "Stop"));
+    for (int i{0}; i < 100 && (tcpClient.isRunning() || 0 < ioContext->getConnectionCount()); i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+    EXPECT_FALSE(tcpClient.isRunning());
+    EXPECT_EQ(ioContext->getConnectionCount(), 0);
+    for (int i{0}; i < 100 && !tcpServer.getAllClientIds().empty(); i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_DISCONNECT_TCP);
+    EXPECT_TRUE(tcpServer.getAllClientIds().empty());
+
+    // Restarted client is attached again
+    ASSERT_EQ(tcpClient.start("localhost", port), CLIENT_START_OK);
+    for (int i{0}; i < 100 && tcpServer.getAllClientIds().size() != 1; i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+    ASSERT_EQ(tcpServer.getAllClientIds().size(), 1);
+    EXPECT_TRUE(tcpServer.sendMsg(tcpServer.getAllClientIds()[0], "Hello"));
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+
+    tcpClient.stop();
+    EXPECT_EQ(ioContext->getConnectionCount(), 0);
+    lock_guard<mutex> lck{received_m};
+    EXPECT_EQ(messages, (vector<string>{"Stop", "Hello"}));
+}
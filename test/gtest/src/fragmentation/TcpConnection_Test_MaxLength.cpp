@@ -0,0 +1,143 @@
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string>
+
+#include "fragmentation/TcpConnection_Test_MaxLength.h"
+#include "HelperFunctions.h"
+
+using namespace std;
+using namespace Test;
+using namespace tcp;
+
+Fragmentation_TcpConnection_Test_MaxLength::Fragmentation_TcpConnection_Test_MaxLength() {}
+Fragmentation_TcpConnection_Test_MaxLength::~Fragmentation_TcpConnection_Test_MaxLength() {}
+
+void Fragmentation_TcpConnection_Test_MaxLength::SetUp()
+{
+    // Buffer incoming messages and oversized message reports on limited server and client
+    tcpServer.setWorkOnMessage([this](const int, const string msg)
+                               {
+                                   lock_guard<mutex> lck{messages_m};
+                                   messagesOnServer.push_back(msg); });
+    tcpServer.setWorkOnOversizedMessage([this](const int clientId)
+                                        {
+                                            lock_guard<mutex> lck{messages_m};
+                                            oversizedOnServer.push_back(clientId); });
+    tcpClientLimited.setWorkOnMessage([this](const string msg)
+                                      {
+                                          lock_guard<mutex> lck{messages_m};
+                                          messagesOnClient.push_back(msg); });
+    tcpClientLimited.setWorkOnOversizedMessage([this]()
+                                               {
+                                                   lock_guard<mutex> lck{messages_m};
+                                                   oversizedOnClient += 1; });
+
+    // Get free TCP ports
+    port = HelperFunctions::getFreePort();
+    ASSERT_NE(port, -1) << "No free port found";
+    ASSERT_EQ(tcpServer.start(port), SERVER_START_OK) << "Unable to start TCP server on port " << port;
+    portUnlimited = HelperFunctions::getFreePort();
+    ASSERT_NE(portUnlimited, -1) << "No free port found";
+    ASSERT_EQ(tcpServerUnlimited.start(portUnlimited), SERVER_START_OK) << "Unable to start TCP server on port " << portUnlimited;
+
+    // Connect clients
+    ASSERT_EQ(tcpClient.start("localhost", port), CLIENT_START_OK) << "Unable to connect TCP client to localhost on port " << port;
+    ASSERT_EQ(tcpClientLimited.start("localhost", portUnlimited), CLIENT_START_OK) << "Unable to connect TCP client to localhost on port " << portUnlimited;
+
+    // Wait for connections to be established (Until both servers registered their client)
+    for (int i{0}; i < 100 && (tcpServer.getAllClientIds().empty() || tcpServerUnlimited.getAllClientIds().empty()); i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+
+    // Get client ID on unlimited server
+    vector<int> clientIds{tcpServerUnlimited.getAllClientIds()};
+    ASSERT_EQ(clientIds.size(), 1);
+    clientIdUnlimited = clientIds[0];
+
+    return;
+}
+
+void Fragmentation_TcpConnection_Test_MaxLength::TearDown()
+{
+    // Stop TCP clients and servers
+    tcpClient.stop();
+    tcpClientLimited.stop();
+    tcpServer.stop();
+    tcpServerUnlimited.stop();
+
+    // Check if no pipe error occurred
+    EXPECT_FALSE(HelperFunctions::getAndResetPipeError()) << "Pipe error occurred!";
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Receive message exceeding the maximum length on server (negative)
+// Steps:      Send a message of 1 MB to a server with maximum message length 100 bytes, followed by a valid message
+// Exp Result: Long message is dropped and reported once, valid message is received
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_MaxLength, NegTest_ClientToServer_Oversized)
+{
+    // Send oversized message and valid message
+    ASSERT_TRUE(tcpClient.sendMsg(string(1000000, 'x')));
+    ASSERT_TRUE(tcpClient.sendMsg("Hello"));
+
+    // Wait for messages to be received
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_LONG_TCP);
+
+    // Check received messages and reports
+    lock_guard<mutex> lck{messages_m};
+    EXPECT_EQ(messagesOnServer, (vector<string>{"Hello"}));
+    EXPECT_EQ(oversizedOnServer.size(), 1);
+    EXPECT_EQ(tcpServer.getOversizedMessageCount(), 1);
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Receive message exceeding the maximum length on client (negative)
+// Steps:      Send a message of 1 MB to a client with maximum message length 100 bytes, followed by a valid message
+// Exp Result: Long message is dropped and reported once, valid message is received
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_MaxLength, NegTest_ServerToClient_Oversized)
+{
+    // Send oversized message and valid message
+    ASSERT_TRUE(tcpServerUnlimited.sendMsg(clientIdUnlimited, string(1000000, 'x')));
+    ASSERT_TRUE(tcpServerUnlimited.sendMsg(clientIdUnlimited, "Hello"));
+
+    // Wait for messages to be received
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_LONG_TCP);
+
+    // Check received messages and reports
+    lock_guard<mutex> lck{messages_m};
+    EXPECT_EQ(messagesOnClient, (vector<string>{"Hello"}));
+    EXPECT_EQ(oversizedOnClient, 1);
+    EXPECT_EQ(tcpClientLimited.getOversizedMessageCount(), 1);
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Receive message of exactly the maximum length (positive)
+// Steps:      Send a message of 100 bytes in both directions
+// Exp Result: Message is received and nothing is reported
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_MaxLength, PosTest_MaximumLength)
+{
+    // Send messages of maximum length
+    const string msg(MAXIMUM_MESSAGE_LENGTH, 'x');
+    ASSERT_TRUE(tcpClient.sendMsg(msg));
+    ASSERT_TRUE(tcpServerUnlimited.sendMsg(clientIdUnlimited, msg));
+
+    // Wait for messages to be received
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+
+    // Check received messages and reports
+    lock_guard<mutex> lck{messages_m};
+    EXPECT_EQ(messagesOnServer, (vector<string>{msg}));
+    EXPECT_EQ(messagesOnClient, (vector<string>{msg}));
+    EXPECT_EQ(tcpServer.getOversizedMessageCount(), 0);
+    EXPECT_EQ(tcpClientLimited.getOversizedMessageCount(), 0);
+
+    return;
+}
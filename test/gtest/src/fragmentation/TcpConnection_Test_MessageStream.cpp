@@ -0,0 +1,195 @@
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string>
+
+#include "fragmentation/TcpConnection_Test_MessageStream.h"
+#include "HelperFunctions.h"
+
+using namespace std;
+using namespace Test;
+using namespace tcp;
+
+Fragmentation_TcpConnection_Test_MessageStream::Fragmentation_TcpConnection_Test_MessageStream() {}
+Fragmentation_TcpConnection_Test_MessageStream::~Fragmentation_TcpConnection_Test_MessageStream() {}
+
+void Fragmentation_TcpConnection_Test_MessageStream::SetUp()
+{
+    // Stream incoming messages on server
+    tcpServer.setWorkOnMessageStream([this](const int)
+                                     {
+                                         lock_guard<mutex> lck{messages_m};
+                                         messagesOnServer.emplace_back(); },
+                                     [this](const int, const char *data, const size_t len)
+                                     {
+                                         lock_guard<mutex> lck{messages_m};
+                                         messagesOnServer.back().content.append(data, len);
+                                         messagesOnServer.back().chunks += 1; },
+                                     [this](const int, const bool complete)
+                                     {
+                                         lock_guard<mutex> lck{messages_m};
+                                         messagesOnServer.back().ended = true;
+                                         messagesOnServer.back().complete = complete; });
+
+    // Stream incoming messages on client
+    tcpClient.setWorkOnMessageStream([this]()
+                                     {
+                                         lock_guard<mutex> lck{messages_m};
+                                         messagesOnClient.emplace_back(); },
+                                     [this](const char *data, const size_t len)
+                                     {
+                                         lock_guard<mutex> lck{messages_m};
+                                         messagesOnClient.back().content.append(data, len);
+                                         messagesOnClient.back().chunks += 1; },
+                                     [this](const bool complete)
+                                     {
+                                         lock_guard<mutex> lck{messages_m};
+                                         messagesOnClient.back().ended = true;
+                                         messagesOnClient.back().complete = complete; });
+
+    // Get free TCP port
+    port = HelperFunctions::getFreePort();
+    ASSERT_NE(port, -1) << "No free port found";
+
+    // Start TCP server and connect client
+    ASSERT_EQ(tcpServer.start(port), SERVER_START_OK) << "Unable to start TCP server on port " << port;
+    ASSERT_EQ(tcpClient.start("localhost", port), CLIENT_START_OK) << "Unable to connect TCP client to localhost on port " << port;
+
+    // Wait for connection to be established (Until the server registered the client)
+    for (int i{0}; i < 100 && tcpServer.getAllClientIds().empty(); i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+
+    // Get client ID
+    vector<int> clientIds{tcpServer.getAllClientIds()};
+    ASSERT_EQ(clientIds.size(), 1);
+    clientId = clientIds[0];
+
+    return;
+}
+
+void Fragmentation_TcpConnection_Test_MessageStream::TearDown()
+{
+    // Stop TCP client and server
+    tcpClient.stop();
+    tcpServer.stop();
+
+    // Check if no pipe error occurred
+    EXPECT_FALSE(HelperFunctions::getAndResetPipeError()) << "Pipe error occurred!";
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Stream large and small messages from client to server (positive)
+// Steps:      Send a message of 5 MB, a short message and an empty message
+// Exp Result: Large message arrives in several chunks, all messages are complete and unchanged
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_MessageStream, PosTest_ClientToServer)
+{
+    // Send messages
+    const string msgLarge(5000000, 'x');
+    ASSERT_TRUE(tcpClient.sendMsg(msgLarge));
+    ASSERT_TRUE(tcpClient.sendMsg("Hello"));
+    ASSERT_TRUE(tcpClient.sendMsg(""));
+
+    // Wait for messages to be received
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_LONG_TCP);
+
+    // Check streamed messages
+    lock_guard<mutex> lck{messages_m};
+    ASSERT_EQ(messagesOnServer.size(), 3);
+    EXPECT_EQ(messagesOnServer[0].content, msgLarge);
+    EXPECT_GT(messagesOnServer[0].chunks, 1);
+    EXPECT_EQ(messagesOnServer[1].content, "Hello");
+    EXPECT_EQ(messagesOnServer[2].content, "");
+    for (const StreamedMessage &msg : messagesOnServer)
+        EXPECT_TRUE(msg.ended && msg.complete);
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Stream large and small messages from server to client (positive)
+// Steps:      Send a message of 5 MB and a short message
+// Exp Result: Large message arrives in several chunks, all messages are complete and unchanged
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_MessageStream, PosTest_ServerToClient)
+{
+    // Send messages
+    const string msgLarge(5000000, 'y');
+    ASSERT_TRUE(tcpServer.sendMsg(clientId, msgLarge));
+    ASSERT_TRUE(tcpServer.sendMsg(clientId, "Hello"));
+
+    // Wait for messages to be received
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_LONG_TCP);
+
+    // Check streamed messages
+    lock_guard<mutex> lck{messages_m};
+    ASSERT_EQ(messagesOnClient.size(), 2);
+    EXPECT_EQ(messagesOnClient[0].content, msgLarge);
+    EXPECT_GT(messagesOnClient[0].chunks, 1);
+    EXPECT_EQ(messagesOnClient[1].content, "Hello");
+    for (const StreamedMessage &msg : messagesOnClient)
+        EXPECT_TRUE(msg.ended && msg.complete);
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Stream message exceeding the maximum length (negative)
+// Steps:      Send raw data longer than the maximum message length from an unlimited client, followed by a valid message
+// Exp Result: Long message is ended as incomplete, valid message is complete
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_MessageStream, NegTest_Oversized)
+{
+    // Connect an unlimited client
+    TcpClient tcpClientUnlimited{'\x00'};
+    ASSERT_EQ(tcpClientUnlimited.start("localhost", port), CLIENT_START_OK) << "Unable to connect TCP client to localhost on port " << port;
+
+    // Send oversized message and valid message
+    ASSERT_TRUE(tcpClientUnlimited.sendMsg(string(MAXIMUM_MESSAGE_LENGTH + 1, 'x')));
+    ASSERT_TRUE(tcpClientUnlimited.sendMsg("Hello"));
+
+    // Wait for messages to be received
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_LONG_TCP);
+    tcpClientUnlimited.stop();
+
+    // Check streamed messages
+    lock_guard<mutex> lck{messages_m};
+    ASSERT_EQ(messagesOnServer.size(), 2);
+    EXPECT_TRUE(messagesOnServer[0].ended);
+    EXPECT_FALSE(messagesOnServer[0].complete);
+    EXPECT_LE(messagesOnServer[0].content.size(), MAXIMUM_MESSAGE_LENGTH);
+    EXPECT_EQ(messagesOnServer[1].content, "Hello");
+    EXPECT_TRUE(messagesOnServer[1].complete);
+    EXPECT_EQ(tcpServer.getOversizedMessageCount(), 1);
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Close connection while a message is streamed (negative)
+// Steps:      Send raw data without delimiter from a continuous client and disconnect it
+// Exp Result: Message is ended as incomplete
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_MessageStream, NegTest_ConnectionClosed)
+{
+    // Connect a continuous client (Sends data without delimiter)
+    TcpClient tcpClientContinuous;
+    ASSERT_EQ(tcpClientContinuous.start("localhost", port), CLIENT_START_OK) << "Unable to connect TCP client to localhost on port " << port;
+
+    // Send incomplete message and disconnect
+    ASSERT_TRUE(tcpClientContinuous.sendMsg("Incomplete"));
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    tcpClientContinuous.stop();
+    this_thread::sleep_for(TestConstants::WAITFOR_DISCONNECT_TCP);
+
+    // Check streamed message
+    lock_guard<mutex> lck{messages_m};
+    ASSERT_EQ(messagesOnServer.size(), 1);
+    EXPECT_EQ(messagesOnServer[0].content, "Incomplete");
+    EXPECT_TRUE(messagesOnServer[0].ended);
+    EXPECT_FALSE(messagesOnServer[0].complete);
+
+    return;
+}
@@ -0,0 +1,196 @@
+#include <chrono>
+#include <thread>
+#include <future>
+#include <vector>
+#include <string>
+
+#include "fragmentation/TcpConnection_Test_Request.h"
+#include "HelperFunctions.h"
+
+using namespace std;
+using namespace Test;
+using namespace tcp;
+
+Fragmentation_TcpConnection_Test_Request::Fragmentation_TcpConnection_Test_Request() {}
+Fragmentation_TcpConnection_Test_Request::~Fragmentation_TcpConnection_Test_Request() {}
+
+void Fragmentation_TcpConnection_Test_Request::SetUp()
+{
+    // Get free TCP port
+    port = HelperFunctions::getFreePort();
+    ASSERT_NE(port, -1) << "No free port found";
+
+    // Collect plain messages
+    tcpServer.setWorkOnMessage([this](const int, const string msg)
+                               {
+                                   lock_guard<mutex> lck{messages_m};
+                                   serverMessages.push_back(msg); });
+    tcpClient.setWorkOnMessage([this](const string msg)
+                               {
+                                   lock_guard<mutex> lck{messages_m};
+                                   clientMessages.push_back(msg); });
+
+    // Start TCP server and client
+    ASSERT_EQ(tcpServer.start(port), SERVER_START_OK) << "Unable to start TCP server on port " << port;
+    ASSERT_EQ(tcpClient.start("localhost", port), CLIENT_START_OK);
+    for (int i{0}; i < 100 && tcpServer.getAllClientIds().empty(); i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+    ASSERT_EQ(tcpServer.getAllClientIds().size(), 1);
+    return;
+}
+
+void Fragmentation_TcpConnection_Test_Request::TearDown()
+{
+    // Stop TCP client and server
+    tcpClient.stop();
+    tcpServer.stop();
+
+    // Check if no pipe error occurred
+    EXPECT_FALSE(HelperFunctions::getAndResetPipeError()) << "Pipe error occurred!";
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Check if a request gets its response
+// Steps:      Send a request to a server replying to each request
+// Exp Result: The future gets the response, no plain message is received
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_Request, PosTest_Request)
+{
+    tcpServer.setWorkOnRequest([this](const int clientId, const uint64_t requestId, const string msg)
+                               { tcpServer.reply(clientId, requestId, "Re: " + msg); });
+
+    future<string> response{tcpClient.request("Hello", chrono::seconds{1})};
+    ASSERT_EQ(response.wait_for(chrono::seconds{2}), future_status::ready);
+    EXPECT_EQ(response.get(), "Re: Hello");
+
+    lock_guard<mutex> lck{messages_m};
+    EXPECT_TRUE(serverMessages.empty());
+    EXPECT_TRUE(clientMessages.empty());
+}
+
+// ====================================================================================================================
+// Desc:       Check if many requests can be in flight on one connection
+// Steps:      Send 100 requests at once, the server replies after a delay decreasing with the request number
+// Exp Result: Responses arrive in different order, but each future gets the response to its own request
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_Request, PosTest_Pipelining)
+{
+    tcpServer.setWorkOnRequest([this](const int clientId, const uint64_t requestId, const string msg)
+                               {
+                                   this_thread::sleep_for(chrono::milliseconds{100 - stoi(msg)});
+                                   tcpServer.reply(clientId, requestId, "Re: " + msg); });
+
+    vector<future<string>> responses;
+    for (int i{0}; i < 100; i += 1)
+        responses.push_back(tcpClient.request(to_string(i), chrono::seconds{2}));
+
+    for (int i{0}; i < 100; i += 1)
+    {
+        ASSERT_EQ(responses[i].wait_for(chrono::seconds{3}), future_status::ready) << "Request " << i;
+        EXPECT_EQ(responses[i].get(), "Re: " + to_string(i));
+    }
+}
+
+// ====================================================================================================================
+// Desc:       Check if plain messages are not affected by requests
+// Steps:      Send plain messages in both directions while a request is answered
+// Exp Result: Plain messages are passed to the message workers, the response only to the future
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_Request, PosTest_PlainMessages)
+{
+    tcpServer.setWorkOnRequest([this](const int clientId, const uint64_t requestId, const string msg)
+                               { tcpServer.reply(clientId, requestId, "Re: " + msg); });
+
+    future<string> response{tcpClient.request("Request", chrono::seconds{1})};
+    EXPECT_TRUE(tcpClient.sendMsg("Plain to server"));
+    EXPECT_TRUE(tcpServer.sendMsg(tcpServer.getAllClientIds()[0], "Plain to client"));
+    ASSERT_EQ(response.wait_for(chrono::seconds{2}), future_status::ready);
+    EXPECT_EQ(response.get(), "Re: Request");
+
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    lock_guard<mutex> lck{messages_m};
+    EXPECT_EQ(serverMessages, vector<string>{"Plain to server"});
+    EXPECT_EQ(clientMessages, vector<string>{"Plain to client"});
+}
+
+// ====================================================================================================================
+// Desc:       Check if a request fails without response in time
+// Steps:      Send a request the server answers too late
+// Exp Result: The future fails with Request_error after the timeout, the late response is dropped
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_Request, NegTest_Timeout)
+{
+    tcpServer.setWorkOnRequest([this](const int clientId, const uint64_t requestId, const string msg)
+                               {
+                                   this_thread::sleep_for(chrono::milliseconds{200});
+                                   tcpServer.reply(clientId, requestId, "Re: " + msg); });
+
+    const chrono::steady_clock::time_point begin{chrono::steady_clock::now()};
+    future<string> response{tcpClient.request("Too slow", chrono::milliseconds{50})};
+    ASSERT_EQ(response.wait_for(chrono::seconds{1}), future_status::ready);
+    EXPECT_GE(chrono::steady_clock::now() - begin, chrono::milliseconds{50});
+    EXPECT_THROW(response.get(), Request_error);
+
+    this_thread::sleep_for(chrono::milliseconds{300});
+    lock_guard<mutex> lck{messages_m};
+    EXPECT_TRUE(clientMessages.empty());
+}
+
+// ====================================================================================================================
+// Desc:       Check if waiting requests fail if the connection is lost
+// Steps:      Send a request the server doesn't answer and stop the server
+// Exp Result: The future fails with Request_error before the timeout
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_Request, NegTest_ConnectionLost)
+{
+    tcpServer.setWorkOnRequest([](const int, const uint64_t, const string) {});
+
+    future<string> response{tcpClient.request("No answer", chrono::seconds{10})};
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    tcpServer.stop();
+    ASSERT_EQ(response.wait_for(chrono::seconds{2}), future_status::ready);
+    EXPECT_THROW(response.get(), Request_error);
+}
+
+// ====================================================================================================================
+// Desc:       Check if a request fails if it can't be sent
+// Steps:      Stop the client and send a request
+// Exp Result: The future fails with Request_error immediately
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_Request, NegTest_NotRunning)
+{
+    tcpClient.stop();
+    future<string> response{tcpClient.request("Not sent", chrono::seconds{10})};
+    ASSERT_EQ(response.wait_for(chrono::seconds{0}), future_status::ready);
+    EXPECT_THROW(response.get(), Request_error);
+}
+
+// ====================================================================================================================
+// Desc:       Check if a client without requests gets messages looking like responses
+// Steps:      Send a plain message starting with a correlation header to a client that never sent a request
+// Exp Result: The message is passed to the message worker unchanged
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_Request, PosTest_CorrelationLikeMessageWithoutRequests)
+{
+    const string msg{"\x01" "42\x02Plain"};
+    EXPECT_TRUE(tcpServer.sendMsg(tcpServer.getAllClientIds()[0], msg));
+
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    lock_guard<mutex> lck{messages_m};
+    EXPECT_EQ(clientMessages, vector<string>{msg});
+}
+
+// ====================================================================================================================
+// Desc:       Check if a request fails if messages are streamed
+// Steps:      Set message stream workers on the client and send a request
+// Exp Result: The future fails with Request_error immediately
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_Request, NegTest_MessageStream)
+{
+    tcpClient.setWorkOnMessageStream([]() {}, [](const char *, const size_t) {}, [](const bool) {});
+    future<string> response{tcpClient.request("Not sent", chrono::seconds{10})};
+    ASSERT_EQ(response.wait_for(chrono::seconds{0}), future_status::ready);
+    EXPECT_THROW(response.get(), Request_error);
+}
@@ -0,0 +1,147 @@
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string>
+
+#include "fragmentation/TcpConnection_Test_SendBatch.h"
+#include "HelperFunctions.h"
+
+using namespace std;
+using namespace Test;
+using namespace tcp;
+
+Fragmentation_TcpConnection_Test_SendBatch::Fragmentation_TcpConnection_Test_SendBatch() {}
+Fragmentation_TcpConnection_Test_SendBatch::~Fragmentation_TcpConnection_Test_SendBatch() {}
+
+void Fragmentation_TcpConnection_Test_SendBatch::SetUp()
+{
+    // Get free TCP port
+    port = HelperFunctions::getFreePort();
+    ASSERT_NE(port, -1) << "No free port found";
+
+    // Collect messages in order of arrival
+    tcpServer.setInlineMessageWork(true);
+    tcpClient.setInlineMessageWork(true);
+    tcpServer.setWorkOnMessage([this](const int, const string msg)
+                               {
+                                   lock_guard<mutex> lck{messages_m};
+                                   serverMessages.push_back(msg); });
+    tcpClient.setWorkOnMessage([this](const string msg)
+                               {
+                                   lock_guard<mutex> lck{messages_m};
+                                   clientMessages.push_back(msg); });
+
+    // Start TCP server and client
+    ASSERT_EQ(tcpServer.start(port), SERVER_START_OK) << "Unable to start TCP server on port " << port;
+    ASSERT_EQ(tcpClient.start("localhost", port), CLIENT_START_OK);
+    for (int i{0}; i < 100 && tcpServer.getAllClientIds().empty(); i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+    ASSERT_EQ(tcpServer.getAllClientIds().size(), 1);
+    clientId = tcpServer.getAllClientIds()[0];
+    return;
+}
+
+void Fragmentation_TcpConnection_Test_SendBatch::TearDown()
+{
+    // Stop TCP client and server
+    tcpClient.stop();
+    tcpServer.stop();
+
+    // Check if no pipe error occurred
+    EXPECT_FALSE(HelperFunctions::getAndResetPipeError()) << "Pipe error occurred!";
+
+    return;
+}
+
+size_t Fragmentation_TcpConnection_Test_SendBatch::waitForMessages(const vector<string> &messages, const size_t count)
+{
+    for (int i{0}; i < 100; i += 1)
+    {
+        {
+            lock_guard<mutex> lck{messages_m};
+            if (messages.size() >= count)
+                break;
+        }
+        this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    }
+    lock_guard<mutex> lck{messages_m};
+    return messages.size();
+}
+
+// ====================================================================================================================
+// Desc:       Check if messages of a server batch are held back until flush
+// Steps:      Open a batch for the client, send 100 messages, wait and flush the batch
+// Exp Result: No message is received before flush, all messages are received in order after
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_SendBatch, PosTest_ServerBatch)
+{
+    ASSERT_TRUE(tcpServer.beginBatch(clientId));
+    for (int i{0}; i < 100; i += 1)
+        ASSERT_TRUE(tcpServer.sendMsg(clientId, "Message " + to_string(i)));
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    EXPECT_EQ(waitForMessages(clientMessages, 0), 0);
+
+    ASSERT_TRUE(tcpServer.flush(clientId));
+    ASSERT_EQ(waitForMessages(clientMessages, 100), 100);
+    lock_guard<mutex> lck{messages_m};
+    for (int i{0}; i < 100; i += 1)
+        EXPECT_EQ(clientMessages[i], "Message " + to_string(i));
+}
+
+// ====================================================================================================================
+// Desc:       Check if a client batch is flushed when its guard is destroyed
+// Steps:      Send 100 messages with a batch guard, wait and leave the scope of the guard
+// Exp Result: No message is received before the guard is destroyed, all messages are received in order after
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_SendBatch, PosTest_ClientBatchGuard)
+{
+    {
+        SendBatch batch{tcpClient};
+        for (int i{0}; i < 100; i += 1)
+            ASSERT_TRUE(tcpClient.sendMsg("Message " + to_string(i)));
+        this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+        EXPECT_EQ(waitForMessages(serverMessages, 0), 0);
+    }
+
+    ASSERT_EQ(waitForMessages(serverMessages, 100), 100);
+    lock_guard<mutex> lck{messages_m};
+    for (int i{0}; i < 100; i += 1)
+        EXPECT_EQ(serverMessages[i], "Message " + to_string(i));
+}
+
+// ====================================================================================================================
+// Desc:       Check if a large batch is written in parts before flush
+// Steps:      Open a batch, send 100 messages of 1000 bytes each (Much more than one batch part), wait and flush
+// Exp Result: Some messages are received before flush, all messages are received in order after
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_SendBatch, PosTest_LargeBatch)
+{
+    ASSERT_TRUE(tcpServer.beginBatch(clientId));
+    for (int i{0}; i < 100; i += 1)
+        ASSERT_TRUE(tcpServer.sendMsg(clientId, to_string(i) + ":" + string(1000, 'x')));
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    const size_t beforeFlush{waitForMessages(clientMessages, 0)};
+    EXPECT_LT(0, beforeFlush);
+    EXPECT_GT(100, beforeFlush);
+
+    ASSERT_TRUE(tcpServer.flush(clientId));
+    ASSERT_EQ(waitForMessages(clientMessages, 100), 100);
+    lock_guard<mutex> lck{messages_m};
+    for (int i{0}; i < 100; i += 1)
+        EXPECT_EQ(clientMessages[i], to_string(i) + ":" + string(1000, 'x'));
+}
+
+// ====================================================================================================================
+// Desc:       Check if no batch can be opened without connection
+// Steps:      Open a batch for an unknown client on the server and on a stopped client
+// Exp Result: Opening fails and flushing has nothing to write
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_SendBatch, NegTest_NotConnected)
+{
+    EXPECT_FALSE(tcpServer.beginBatch(clientId + 1000));
+    EXPECT_TRUE(tcpServer.flush(clientId + 1000));
+
+    tcpClient.stop();
+    EXPECT_FALSE(tcpClient.beginBatch());
+    EXPECT_TRUE(tcpClient.flush());
+}
@@ -0,0 +1,200 @@
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string>
+
+#include "fragmentation/TcpConnection_Test_SpillToDisk.h"
+#include "HelperFunctions.h"
+
+using namespace std;
+using namespace Test;
+using namespace tcp;
+
+Fragmentation_TcpConnection_Test_SpillToDisk::Fragmentation_TcpConnection_Test_SpillToDisk() {}
+Fragmentation_TcpConnection_Test_SpillToDisk::~Fragmentation_TcpConnection_Test_SpillToDisk() {}
+
+void Fragmentation_TcpConnection_Test_SpillToDisk::SetUp()
+{
+    // Get free TCP port
+    port = HelperFunctions::getFreePort();
+    ASSERT_NE(port, -1) << "No free port found";
+
+    // Record messages received by the client
+    tcpClient.setWorkOnMessage([this](const string msg)
+                               {
+                                   lock_guard<mutex> lck{messagesClient_m};
+                                   messagesClient.push_back(msg);
+                                   return; });
+
+    // Start TCP server and connect client
+    ASSERT_EQ(tcpServer.start(port), SERVER_START_OK) << "Unable to start TCP server on port " << port;
+    ASSERT_EQ(tcpClient.start("localhost", port), CLIENT_START_OK) << "Unable to connect TCP client to localhost on port " << port;
+
+    // Wait for connection to be established
+    for (int i{0}; i < 100 && tcpServer.getAllClientIds().empty(); i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+    ASSERT_FALSE(tcpServer.getAllClientIds().empty()) << "Client not connected";
+
+    return;
+}
+
+void Fragmentation_TcpConnection_Test_SpillToDisk::TearDown()
+{
+    // Stop TCP client and server
+    tcpClient.stop();
+    tcpServer.stop();
+
+    // Check if no pipe error occurred
+    EXPECT_FALSE(HelperFunctions::getAndResetPipeError()) << "Pipe error occurred!";
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Spill large messages to disk on the server (positive)
+// Steps:      Set spill threshold of 4096 bytes, send small and large messages to server
+// Exp Result: Only messages larger than 4096 bytes are spilled, all are received unchanged
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_SpillToDisk, PosTest_ServerSpillsLargeMessages)
+{
+    tcpServer.setSpillToDisk(4096, "/tmp");
+
+    // Send messages of different sizes one by one (Each one is handed to its own work thread)
+    const vector<string> messagesExpected{"Hello", string(4096, 'a'), string(4097, 'b'), string(1000000, 'c'), "World"};
+    for (const string &msg : messagesExpected)
+    {
+        ASSERT_TRUE(tcpClient.sendMsg(msg));
+        this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    }
+
+    // Check received messages and their storage
+    SpillHandler &handler{tcpServer.getHandler()};
+    lock_guard<mutex> lck{handler.messages_m};
+    EXPECT_EQ(handler.messages, messagesExpected);
+    EXPECT_EQ(handler.messagesSpilled, (vector<bool>{false, false, true, true, false}));
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Spill large messages to disk on the client (positive)
+// Steps:      Set spill threshold of 4096 bytes, send small and large messages to client
+// Exp Result: The string based worker gets all messages unchanged
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_SpillToDisk, PosTest_ClientSpillsLargeMessages)
+{
+    tcpClient.setSpillToDisk(4096, "/tmp");
+
+    // Send messages of different sizes one by one
+    const int clientId{tcpServer.getAllClientIds()[0]};
+    const vector<string> messagesExpected{"Hello", string(1000000, 'c'), "World"};
+    for (const string &msg : messagesExpected)
+    {
+        ASSERT_TRUE(tcpServer.sendMsg(clientId, msg));
+        this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    }
+
+    // Check received messages
+    lock_guard<mutex> lck{messagesClient_m};
+    EXPECT_EQ(messagesClient, messagesExpected);
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Work on spilled messages without copying them (positive)
+// Steps:      Set spill threshold of 4096 bytes and a spilled message worker on the client, send small and large messages to client
+// Exp Result: The large message is passed to the spilled message worker only, the small messages to the string based worker
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_SpillToDisk, PosTest_ClientSpilledMessageWorker)
+{
+    tcpClient.setSpillToDisk(4096, "/tmp");
+
+    // Record spilled messages
+    vector<string> messagesSpilled;
+    mutex messagesSpilled_m;
+    tcpClient.setWorkOnSpilledMessage([&](const char *content, const size_t len)
+                                      {
+                                          lock_guard<mutex> lck{messagesSpilled_m};
+                                          messagesSpilled.push_back(string{content, len});
+                                          return; });
+
+    // Send messages of different sizes one by one
+    const int clientId{tcpServer.getAllClientIds()[0]};
+    for (const string &msg : {string{"Hello"}, string(1000000, 'c'), string{"World"}})
+    {
+        ASSERT_TRUE(tcpServer.sendMsg(clientId, msg));
+        this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    }
+
+    // Check received messages
+    {
+        lock_guard<mutex> lck{messagesClient_m};
+        EXPECT_EQ(messagesClient, (vector<string>{"Hello", "World"}));
+    }
+    lock_guard<mutex> lck{messagesSpilled_m};
+    EXPECT_EQ(messagesSpilled, (vector<string>{string(1000000, 'c')}));
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Spill to a directory that doesn't exist (negative)
+// Steps:      Set spill threshold of 4096 bytes with an invalid directory, send small and large messages to server
+// Exp Result: The large message is dropped, the small messages are received unchanged
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_SpillToDisk, NegTest_InvalidDirectory)
+{
+    tcpServer.setSpillToDisk(4096, "/nonexistent/spill/directory");
+
+    // Send messages of different sizes one by one
+    for (const string &msg : {string{"Hello"}, string(100000, 'c'), string{"World"}})
+    {
+        ASSERT_TRUE(tcpClient.sendMsg(msg));
+        this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    }
+
+    // Check received messages
+    SpillHandler &handler{tcpServer.getHandler()};
+    lock_guard<mutex> lck{handler.messages_m};
+    EXPECT_EQ(handler.messages, (vector<string>{"Hello", "World"}));
+    EXPECT_EQ(handler.messagesSpilled, (vector<bool>{false, false}));
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Use a spilled message directly (positive)
+// Steps:      Spill a message, append to it, copy and move it
+// Exp Result: Content is readable through the mapping after each step, moved-from message is empty
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_SpillToDisk, PosTest_MessageSpill)
+{
+    Message msg;
+    msg.append("Hello", 5);
+    ASSERT_TRUE(msg.spill("/tmp"));
+    EXPECT_TRUE(msg.isSpilled());
+    EXPECT_FALSE(msg.isInline());
+    EXPECT_EQ(msg.view(), "Hello");
+
+    // Append after mapping (Mapping is renewed)
+    EXPECT_TRUE(msg.append(" World", 6));
+    EXPECT_EQ(msg.view(), "Hello World");
+
+    // Copy into memory and move the spilled message
+    const Message copy{msg};
+    EXPECT_FALSE(copy.isSpilled());
+    EXPECT_EQ(copy.view(), "Hello World");
+    Message moved{move(msg)};
+    EXPECT_TRUE(moved.isSpilled());
+    EXPECT_EQ(moved.str(), "Hello World");
+    EXPECT_TRUE(msg.empty());
+    EXPECT_FALSE(msg.isSpilled());
+
+    // Clear releases the spill file
+    moved.clear();
+    EXPECT_FALSE(moved.isSpilled());
+    EXPECT_TRUE(moved.empty());
+
+    return;
+}
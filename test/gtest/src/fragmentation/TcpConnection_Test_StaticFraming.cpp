@@ -0,0 +1,105 @@
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string>
+
+#include "fragmentation/TcpConnection_Test_StaticFraming.h"
+#include "HelperFunctions.h"
+
+using namespace std;
+using namespace Test;
+using namespace tcp;
+
+Fragmentation_TcpConnection_Test_StaticFraming::Fragmentation_TcpConnection_Test_StaticFraming() {}
+Fragmentation_TcpConnection_Test_StaticFraming::~Fragmentation_TcpConnection_Test_StaticFraming() {}
+
+void Fragmentation_TcpConnection_Test_StaticFraming::SetUp()
+{
+    // Buffer incoming messages on server and client
+    tcpServer.setWorkOnMessage([this](const int, const string msg)
+                               {
+                                   lock_guard<mutex> lck{messages_m};
+                                   messagesOnServer.push_back(msg); });
+    tcpClient.setWorkOnMessage([this](const string msg)
+                               {
+                                   lock_guard<mutex> lck{messages_m};
+                                   messagesOnClient.push_back(msg); });
+
+    // Get free TCP port
+    port = HelperFunctions::getFreePort();
+    ASSERT_NE(port, -1) << "No free port found";
+
+    // Start TCP server and connect client
+    ASSERT_EQ(tcpServer.start(port), SERVER_START_OK) << "Unable to start TCP server on port " << port;
+    ASSERT_EQ(tcpClient.start("localhost", port), CLIENT_START_OK) << "Unable to connect TCP client to localhost on port " << port;
+
+    // Wait for connection to be established
+    this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+
+    // Get client ID
+    vector<int> clientIds{tcpServer.getAllClientIds()};
+    ASSERT_EQ(clientIds.size(), 1);
+    clientId = clientIds[0];
+
+    return;
+}
+
+void Fragmentation_TcpConnection_Test_StaticFraming::TearDown()
+{
+    // Stop TCP client and server
+    tcpClient.stop();
+    tcpServer.stop();
+
+    // Check if no pipe error occurred
+    EXPECT_FALSE(HelperFunctions::getAndResetPipeError()) << "Pipe error occurred!";
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Transfer messages with compile-time framing (positive)
+// Steps:      Send messages from client to server and from server to client
+// Exp Result: All messages are received separately and unchanged
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_StaticFraming, PosTest_MsgTransfer)
+{
+    // Send messages in both directions
+    ASSERT_TRUE(tcpClient.sendMsg("Hello"));
+    ASSERT_TRUE(tcpClient.sendMsg("Server"));
+    ASSERT_TRUE(tcpServer.sendMsg(clientId, "Hello"));
+    ASSERT_TRUE(tcpServer.sendMsg(clientId, "Client"));
+
+    // Wait for messages to be received
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+
+    // Check received messages
+    lock_guard<mutex> lck{messages_m};
+    EXPECT_EQ(messagesOnServer, (vector<string>{"Hello", "Server"}));
+    EXPECT_EQ(messagesOnClient, (vector<string>{"Hello", "Client"}));
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Send messages violating the compile-time framing (negative)
+// Steps:      Send a message containing the delimiter and a message exceeding the maximum length
+// Exp Result: Both messages are rejected and nothing is received
+// ====================================================================================================================
+TEST_F(Fragmentation_TcpConnection_Test_StaticFraming, NegTest_MsgTransfer_InvalidMsg)
+{
+    // Send invalid messages in both directions
+    EXPECT_FALSE(tcpClient.sendMsg("Hello\nServer"));
+    EXPECT_FALSE(tcpClient.sendMsg(string(101, 'x')));
+    EXPECT_FALSE(tcpServer.sendMsg(clientId, "Hello\nClient"));
+    EXPECT_FALSE(tcpServer.sendMsg(clientId, string(101, 'x')));
+
+    // Wait for messages to be received
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+
+    // Check that nothing is received
+    lock_guard<mutex> lck{messages_m};
+    EXPECT_TRUE(messagesOnServer.empty());
+    EXPECT_TRUE(messagesOnClient.empty());
+
+    return;
+}
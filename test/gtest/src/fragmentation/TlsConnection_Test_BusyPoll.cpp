@@ -0,0 +1,93 @@
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string>
+
+#include "fragmentation/TlsConnection_Test_BusyPoll.h"
+#include "HelperFunctions.h"
+
+using namespace std;
+using namespace Test;
+using namespace tcp;
+
+Fragmentation_TlsConnection_Test_BusyPoll::Fragmentation_TlsConnection_Test_BusyPoll() {}
+Fragmentation_TlsConnection_Test_BusyPoll::~Fragmentation_TlsConnection_Test_BusyPoll() {}
+
+void Fragmentation_TlsConnection_Test_BusyPoll::SetUp()
+{
+    // Get free TLS port
+    port = HelperFunctions::getFreePort();
+    ASSERT_NE(port, -1) << "No free port found";
+
+    // Collect messages in order of arrival with busy poll on both sides
+    tlsServer.setInlineMessageWork(true);
+    tlsClient.setInlineMessageWork(true);
+    tlsServer.setBusyPoll(BusyPollPolicy{chrono::microseconds{100}, {}});
+    tlsClient.setBusyPoll(BusyPollPolicy{chrono::microseconds{100}, {}});
+    tlsServer.setWorkOnMessage([this](const int, const string msg)
+                               {
+                                   lock_guard<mutex> lck{messages_m};
+                                   serverMessages.push_back(msg); });
+    tlsClient.setWorkOnMessage([this](const string msg)
+                               {
+                                   lock_guard<mutex> lck{messages_m};
+                                   clientMessages.push_back(msg); });
+
+    // Start TLS server and client
+    tlsServer.setCertificates(KeyPaths::CaCert, KeyPaths::ServerCert, KeyPaths::ServerKey);
+    tlsClient.setCertificates(KeyPaths::CaCert, KeyPaths::ClientCert, KeyPaths::ClientKey);
+    ASSERT_EQ(tlsServer.start(port), SERVER_START_OK) << "Unable to start TLS server on port " << port;
+    ASSERT_EQ(tlsClient.start("localhost", port), CLIENT_START_OK);
+    for (int i{0}; i < 100 && tlsServer.getAllClientIds().empty(); i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TLS);
+    ASSERT_EQ(tlsServer.getAllClientIds().size(), 1);
+    return;
+}
+
+void Fragmentation_TlsConnection_Test_BusyPoll::TearDown()
+{
+    // Stop TLS client and server
+    tlsClient.stop();
+    tlsServer.stop();
+
+    // Check if no pipe error occurred
+    EXPECT_FALSE(HelperFunctions::getAndResetPipeError()) << "Pipe error occurred!";
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Check if data buffered in the TLS channel is read without spinning on the socket
+// Steps:      Send 500 messages in each direction (Many of them arrive in one TLS record read)
+// Exp Result: All messages are received in order
+// ====================================================================================================================
+TEST_F(Fragmentation_TlsConnection_Test_BusyPoll, PosTest_BothDirections)
+{
+    const size_t count{500};
+    const int clientId{tlsServer.getAllClientIds()[0]};
+    for (size_t i{0}; i < count; i += 1)
+    {
+        ASSERT_TRUE(tlsClient.sendMsg("To server " + to_string(i)));
+        ASSERT_TRUE(tlsServer.sendMsg(clientId, "To client " + to_string(i)));
+    }
+
+    // Wait for all messages
+    for (int i{0}; i < 100; i += 1)
+    {
+        {
+            lock_guard<mutex> lck{messages_m};
+            if (serverMessages.size() >= count && clientMessages.size() >= count)
+                break;
+        }
+        this_thread::sleep_for(TestConstants::WAITFOR_MSG_TLS);
+    }
+
+    lock_guard<mutex> lck{messages_m};
+    ASSERT_EQ(serverMessages.size(), count);
+    ASSERT_EQ(clientMessages.size(), count);
+    for (size_t i{0}; i < count; i += 1)
+    {
+        EXPECT_EQ(serverMessages[i], "To server " + to_string(i));
+        EXPECT_EQ(clientMessages[i], "To client " + to_string(i));
+    }
+}
@@ -0,0 +1,144 @@
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string>
+#include <algorithm>
+
+#include "fragmentation/TlsConnection_Test_IoContext.h"
+#include "HelperFunctions.h"
+
+using namespace std;
+using namespace Test;
+using namespace tcp;
+
+Fragmentation_TlsConnection_Test_IoContext::Fragmentation_TlsConnection_Test_IoContext() {}
+Fragmentation_TlsConnection_Test_IoContext::~Fragmentation_TlsConnection_Test_IoContext() {}
+
+void Fragmentation_TlsConnection_Test_IoContext::SetUp()
+{
+    // Get free TLS port
+    port = HelperFunctions::getFreePort();
+    ASSERT_NE(port, -1) << "No free port found";
+
+    // Start TLS server
+    tlsServer.setCertificates(KeyPaths::CaCert, KeyPaths::ServerCert, KeyPaths::ServerKey);
+    ASSERT_EQ(tlsServer.start(port), SERVER_START_OK) << "Unable to start TLS server on port " << port;
+
+    // Start 2 TLS clients attached to the I/O context
+    for (int i{0}; i < 2; i += 1)
+    {
+        tlsClients.emplace_back(new TlsClient{'\x00'});
+        tlsClients.back()->setCertificates(KeyPaths::CaCert, KeyPaths::ClientCert, KeyPaths::ClientKey);
+        tlsClients.back()->setIoContext(ioContext);
+        tlsClients.back()->setWorkOnMessage([this](const string msg)
+                                            {
+                                                lock_guard<mutex> lck{received_m};
+                                                received.push_back(msg); });
+        ASSERT_EQ(tlsClients.back()->start("localhost", port), CLIENT_START_OK) << "Unable to connect TLS client " << i;
+    }
+
+    // Wait for all connections to be established
+    for (int i{0}; i < 100 && tlsServer.getAllClientIds().size() < 2; i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TLS);
+    ASSERT_EQ(tlsServer.getAllClientIds().size(), 2);
+    return;
+}
+
+void Fragmentation_TlsConnection_Test_IoContext::TearDown()
+{
+    // Stop TLS clients and server
+    for (auto &client : tlsClients)
+        client->stop();
+    tlsServer.stop();
+
+    // Check if no pipe error occurred
+    EXPECT_FALSE(HelperFunctions::getAndResetPipeError()) << "Pipe error occurred!";
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Check if the only worker of the context is not blocked by TLS protocol data (Session tickets) of another client
+// Steps:      Wait until the session tickets are read, then send a message to one of two clients only
+// Exp Result: The message is received
+// ====================================================================================================================
+TEST_F(Fragmentation_TlsConnection_Test_IoContext, PosTest_SingleWorkerNotBlocked)
+{
+    this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TLS);
+    for (const int clientId : tlsServer.getAllClientIds())
+    {
+        EXPECT_TRUE(tlsServer.sendMsg(clientId, "Hello client " + to_string(clientId)));
+        this_thread::sleep_for(TestConstants::WAITFOR_MSG_TLS);
+
+        lock_guard<mutex> lck{received_m};
+        ASSERT_EQ(received.size(), 1) << "Message to client " << clientId << " not received";
+        EXPECT_EQ(received[0], "Hello client " + to_string(clientId));
+        received.clear();
+    }
+}
+
+// ====================================================================================================================
+// Desc:       Check if the only worker of the context is not blocked by an incomplete TLS record of another client
+// Steps:      Connect a third client through a proxy, send a message to it that the proxy passes in two pieces with a pause,
+//             send a message to another client during the pause
+// Exp Result: The message to the other client is received during the pause, the split message after it unchanged
+// ====================================================================================================================
+TEST_F(Fragmentation_TlsConnection_Test_IoContext, PosTest_SplitRecordNotBlocking)
+{
+    const vector<int> clientIdsDirect{tlsServer.getAllClientIds()};
+
+    // Connect a client attached to the same context through the proxy
+    SplitProxy proxy;
+    const int proxyPort{HelperFunctions::getFreePort()};
+    ASSERT_NE(proxyPort, -1) << "No free port found";
+    ASSERT_TRUE(proxy.start(proxyPort, port)) << "Unable to start proxy on port " << proxyPort;
+    vector<string> receivedSplit;
+    mutex receivedSplit_m;
+    TlsClient splitClient{'\x00'};
+    splitClient.setCertificates(KeyPaths::CaCert, KeyPaths::ClientCert, KeyPaths::ClientKey);
+    splitClient.setIoContext(ioContext);
+    splitClient.setWorkOnMessage([&](const string msg)
+                                 {
+                                     lock_guard<mutex> lck{receivedSplit_m};
+                                     receivedSplit.push_back(msg); });
+    ASSERT_EQ(splitClient.start("localhost", proxyPort), CLIENT_START_OK) << "Unable to connect TLS client through proxy";
+    for (int i{0}; i < 100 && tlsServer.getAllClientIds().size() < 3; i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TLS);
+    vector<int> clientIds{tlsServer.getAllClientIds()};
+    ASSERT_EQ(clientIds.size(), 3);
+    int splitClientId{-1};
+    for (const int clientId : clientIds)
+    {
+        if (find(clientIdsDirect.begin(), clientIdsDirect.end(), clientId) == clientIdsDirect.end())
+            splitClientId = clientId;
+    }
+    this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TLS);
+
+    // Send a message the proxy splits, so the worker reads an incomplete TLS record
+    const string msgSplit(1000, 's');
+    proxy.splitNext(chrono::milliseconds{1000});
+    EXPECT_TRUE(tlsServer.sendMsg(splitClientId, msgSplit));
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TLS);
+
+    // Message to another client is received during the pause
+    EXPECT_TRUE(tlsServer.sendMsg(clientIdsDirect[0], "Hello"));
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TLS * 2);
+    {
+        lock_guard<mutex> lck{received_m};
+        EXPECT_EQ(received, vector<string>{"Hello"}) << "Worker blocked by incomplete TLS record";
+    }
+    {
+        lock_guard<mutex> lck{receivedSplit_m};
+        EXPECT_TRUE(receivedSplit.empty());
+    }
+
+    // Split message is received after the pause
+    this_thread::sleep_for(chrono::milliseconds{1000});
+    {
+        lock_guard<mutex> lck{receivedSplit_m};
+        EXPECT_EQ(receivedSplit, vector<string>{msgSplit});
+    }
+
+    splitClient.stop();
+    proxy.stop();
+}
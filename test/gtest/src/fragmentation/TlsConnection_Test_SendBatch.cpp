@@ -0,0 +1,96 @@
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string>
+
+#include "fragmentation/TlsConnection_Test_SendBatch.h"
+#include "HelperFunctions.h"
+
+using namespace std;
+using namespace Test;
+using namespace tcp;
+
+Fragmentation_TlsConnection_Test_SendBatch::Fragmentation_TlsConnection_Test_SendBatch() {}
+Fragmentation_TlsConnection_Test_SendBatch::~Fragmentation_TlsConnection_Test_SendBatch() {}
+
+void Fragmentation_TlsConnection_Test_SendBatch::SetUp()
+{
+    // Get free TLS port
+    port = HelperFunctions::getFreePort();
+    ASSERT_NE(port, -1) << "No free port found";
+
+    // Collect messages in order of arrival
+    tlsServer.setInlineMessageWork(true);
+    tlsClient.setInlineMessageWork(true);
+    tlsServer.setWorkOnMessage([this](const int, const string msg)
+                               {
+                                   lock_guard<mutex> lck{messages_m};
+                                   serverMessages.push_back(msg); });
+    tlsClient.setWorkOnMessage([this](const string msg)
+                               {
+                                   lock_guard<mutex> lck{messages_m};
+                                   clientMessages.push_back(msg); });
+
+    // Start TLS server and client
+    tlsServer.setCertificates(KeyPaths::CaCert, KeyPaths::ServerCert, KeyPaths::ServerKey);
+    tlsClient.setCertificates(KeyPaths::CaCert, KeyPaths::ClientCert, KeyPaths::ClientKey);
+    ASSERT_EQ(tlsServer.start(port), SERVER_START_OK) << "Unable to start TLS server on port " << port;
+    ASSERT_EQ(tlsClient.start("localhost", port), CLIENT_START_OK);
+    for (int i{0}; i < 100 && tlsServer.getAllClientIds().empty(); i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TLS);
+    ASSERT_EQ(tlsServer.getAllClientIds().size(), 1);
+    return;
+}
+
+void Fragmentation_TlsConnection_Test_SendBatch::TearDown()
+{
+    // Stop TLS client and server
+    tlsClient.stop();
+    tlsServer.stop();
+
+    // Check if no pipe error occurred
+    EXPECT_FALSE(HelperFunctions::getAndResetPipeError()) << "Pipe error occurred!";
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Check if batches are coalesced into TLS records in both directions
+// Steps:      Send 100 messages in each direction with batch guards
+// Exp Result: All messages are received in order
+// ====================================================================================================================
+TEST_F(Fragmentation_TlsConnection_Test_SendBatch, PosTest_BothDirections)
+{
+    const int clientId{tlsServer.getAllClientIds()[0]};
+    {
+        SendBatch serverBatch{tlsServer, clientId};
+        SendBatch clientBatch{tlsClient};
+        for (int i{0}; i < 100; i += 1)
+        {
+            ASSERT_TRUE(tlsServer.sendMsg(clientId, "To client " + to_string(i)));
+            ASSERT_TRUE(tlsClient.sendMsg("To server " + to_string(i)));
+        }
+        EXPECT_TRUE(serverBatch.flush());
+        EXPECT_TRUE(clientBatch.flush());
+    }
+
+    // Wait for all messages
+    for (int i{0}; i < 100; i += 1)
+    {
+        {
+            lock_guard<mutex> lck{messages_m};
+            if (100 <= serverMessages.size() && 100 <= clientMessages.size())
+                break;
+        }
+        this_thread::sleep_for(TestConstants::WAITFOR_MSG_TLS);
+    }
+
+    lock_guard<mutex> lck{messages_m};
+    ASSERT_EQ(serverMessages.size(), 100);
+    ASSERT_EQ(clientMessages.size(), 100);
+    for (int i{0}; i < 100; i += 1)
+    {
+        EXPECT_EQ(serverMessages[i], "To server " + to_string(i));
+        EXPECT_EQ(clientMessages[i], "To client " + to_string(i));
+    }
+}
@@ -0,0 +1,199 @@
+#include <chrono>
+#include <thread>
+
+#include "general/TcpClient_Test_Reconnect.h"
+#include "HelperFunctions.h"
+#include "TestDefines.h"
+
+using namespace std;
+using namespace Test;
+using namespace tcp;
+
+General_TcpClient_Test_Reconnect::General_TcpClient_Test_Reconnect() {}
+General_TcpClient_Test_Reconnect::~General_TcpClient_Test_Reconnect() {}
+
+void General_TcpClient_Test_Reconnect::SetUp()
+{
+    // Get free TCP port
+    port = HelperFunctions::getFreePort();
+    ASSERT_NE(port, -1) << "No free port found";
+    ASSERT_EQ(tcpServer.start(port), SERVER_START_OK);
+
+    // Reconnect quickly and record all reconnects
+    ReconnectPolicy policy;
+    policy.initialDelay = chrono::milliseconds{10};
+    policy.maxDelay = chrono::milliseconds{50};
+    tcpClient.setReconnectPolicy(policy);
+    tcpClient.setWorkOnReconnect([this](const bool success, const unsigned int attempts)
+                                 {
+                                     lock_guard<mutex> lck{reconnects_m};
+                                     reconnects.push_back({success, attempts}); });
+
+    // Start TCP client
+    ASSERT_EQ(tcpClient.start("localhost", port), CLIENT_START_OK);
+    for (int i{0}; i < 100 && tcpServer.getClientIds().empty(); i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+    ASSERT_EQ(tcpServer.getClientIds().size(), 1);
+    return;
+}
+
+void General_TcpClient_Test_Reconnect::TearDown()
+{
+    // Stop TCP server and client
+    tcpClient.stop();
+    tcpServer.stop();
+
+    // Check if no pipe error occurred
+    EXPECT_FALSE(HelperFunctions::getAndResetPipeError()) << "Pipe error occurred!";
+
+    return;
+}
+
+bool General_TcpClient_Test_Reconnect::waitForReconnects(const size_t count)
+{
+    for (int i{0}; i < 100; i += 1)
+    {
+        {
+            lock_guard<mutex> lck{reconnects_m};
+            if (reconnects.size() >= count)
+                return true;
+        }
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+    }
+    return false;
+}
+
+// ====================================================================================================================
+// Desc:       Check if the client reconnects after losing the connection
+// Steps:      Drop the connection of the client and send a message after reconnecting
+// Exp Result: Client reconnects with the first attempt, is running and the server receives the message
+// ====================================================================================================================
+TEST_F(General_TcpClient_Test_Reconnect, PosTest_Reconnect)
+{
+    tcpClient.dropConnection();
+    ASSERT_TRUE(waitForReconnects(1)) << "Client didn't reconnect";
+    {
+        lock_guard<mutex> lck{reconnects_m};
+        EXPECT_TRUE(reconnects[0].first);
+        EXPECT_EQ(reconnects[0].second, 1);
+    }
+    EXPECT_TRUE(tcpClient.isRunning());
+
+    for (int i{0}; i < 100 && tcpServer.getClientIds().size() != 1; i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+    ASSERT_EQ(tcpServer.getClientIds().size(), 1);
+
+    EXPECT_TRUE(tcpClient.sendMsg("Hello after reconnect"));
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    vector<TestApi::MessageFromClient> messages{tcpServer.getBufferedMsg()};
+    ASSERT_EQ(messages.size(), 1);
+    EXPECT_EQ(messages[0].msg, "Hello after reconnect");
+}
+
+// ====================================================================================================================
+// Desc:       Check if the client reconnects repeatedly
+// Steps:      Drop the connection of the client three times
+// Exp Result: Three successful reconnects
+// ====================================================================================================================
+TEST_F(General_TcpClient_Test_Reconnect, PosTest_ReconnectRepeatedly)
+{
+    for (size_t i{1}; i <= 3; i += 1)
+    {
+        tcpClient.dropConnection();
+        ASSERT_TRUE(waitForReconnects(i)) << "Client didn't reconnect " << i << " times";
+    }
+
+    lock_guard<mutex> lck{reconnects_m};
+    for (const auto &reconnect : reconnects)
+        EXPECT_TRUE(reconnect.first);
+    EXPECT_TRUE(tcpClient.isRunning());
+}
+
+// ====================================================================================================================
+// Desc:       Check if the client gives up after the maximum number of attempts
+// Steps:      Limit attempts to 3 and stop the server
+// Exp Result: Reconnect worker gets false and 3 attempts, client is not running
+// ====================================================================================================================
+TEST_F(General_TcpClient_Test_Reconnect, NegTest_MaxAttempts)
+{
+    ReconnectPolicy policy;
+    policy.maxAttempts = 3;
+    policy.initialDelay = chrono::milliseconds{10};
+    policy.maxDelay = chrono::milliseconds{20};
+    tcpClient.setReconnectPolicy(policy);
+
+    tcpServer.stop();
+    ASSERT_TRUE(waitForReconnects(1)) << "Client didn't give up reconnecting";
+    {
+        lock_guard<mutex> lck{reconnects_m};
+        EXPECT_FALSE(reconnects[0].first);
+        EXPECT_EQ(reconnects[0].second, 3);
+    }
+    EXPECT_FALSE(tcpClient.isRunning());
+}
+
+// ====================================================================================================================
+// Desc:       Check if stopping the client aborts reconnecting
+// Steps:      Set a long reconnect delay, stop the server and then stop the client
+// Exp Result: Client stops immediately, reconnect worker is not called
+// ====================================================================================================================
+TEST_F(General_TcpClient_Test_Reconnect, NegTest_StopWhileReconnecting)
+{
+    ReconnectPolicy policy;
+    policy.initialDelay = chrono::seconds{10};
+    tcpClient.setReconnectPolicy(policy);
+
+    tcpServer.stop();
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    EXPECT_FALSE(tcpClient.isRunning());
+
+    const auto startTime{chrono::steady_clock::now()};
+    tcpClient.stop();
+    EXPECT_LT(chrono::steady_clock::now() - startTime, chrono::seconds{1});
+
+    lock_guard<mutex> lck{reconnects_m};
+    EXPECT_TRUE(reconnects.empty());
+}
+
+// ====================================================================================================================
+// Desc:       Check if the client doesn't reconnect when reconnecting is disabled
+// Steps:      Disable reconnecting and drop the connection of the client
+// Exp Result: Client is not running and the reconnect worker is not called
+// ====================================================================================================================
+TEST_F(General_TcpClient_Test_Reconnect, NegTest_Disabled)
+{
+    tcpClient.disableReconnect();
+    tcpClient.dropConnection();
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    EXPECT_FALSE(tcpClient.isRunning());
+
+    lock_guard<mutex> lck{reconnects_m};
+    EXPECT_TRUE(reconnects.empty());
+}
+
+// ====================================================================================================================
+// Desc:       Check if the reconnect delays grow exponentially up to the maximum and are randomized by the jitter
+// Steps:      Get delays without jitter and with full jitter
+// Exp Result: 100, 200, 400, 800, 1000, 1000 ms without jitter, each delay at most the same with full jitter
+// ====================================================================================================================
+TEST_F(General_TcpClient_Test_Reconnect, PosTest_Backoff)
+{
+    ReconnectPolicy policy;
+    policy.initialDelay = chrono::milliseconds{100};
+    policy.maxDelay = chrono::milliseconds{1000};
+    policy.multiplier = 2.0;
+
+    policy.jitter = 0.0;
+    ReconnectBackoff fixed{policy};
+    policy.jitter = 1.0;
+    ReconnectBackoff randomized{policy};
+
+    const vector<chrono::milliseconds::rep> expected{100, 200, 400, 800, 1000, 1000};
+    for (const auto delay : expected)
+    {
+        EXPECT_EQ(fixed.next().count(), delay);
+        const chrono::milliseconds jittered{randomized.next()};
+        EXPECT_GE(jittered.count(), 0);
+        EXPECT_LE(jittered.count(), delay);
+    }
+}
@@ -1,8 +1,12 @@
 #include <chrono>
 #include <thread>
+#include <future>
+#include <memory>
+#include <vector>
 
 #include "general/TcpClient_Test_Start.h"
 #include "HelperFunctions.h"
+#include "TestDefines.h"
 
 using namespace std;
 using namespace Test;
@@ -88,3 +92,91 @@ TEST_F(General_TcpClient_Test_Start, NegTest_AlreadyRunning)
     EXPECT_EQ(tcpClient.start("localhost", port), -1);
     EXPECT_EQ(tcpServer.getClientIds().size(), 1);
 }
+
+// ====================================================================================================================
+// Desc:       Check if client connects to the server given by its IP address
+// Steps:      Start TCP client with IPv4 address 127.0.0.1
+// Exp Result: CLIENT_START_OK
+// ====================================================================================================================
+TEST_F(General_TcpClient_Test_Start, PosTest_IpAddress)
+{
+    EXPECT_EQ(tcpClient.start("127.0.0.1", port), CLIENT_START_OK);
+    EXPECT_EQ(tcpServer.getClientIds().size(), 1);
+}
+
+// ====================================================================================================================
+// Desc:       Check if client doesn't start if the server address can't be resolved
+// Steps:      Try to start TCP client with a host in the reserved top level domain .invalid
+// Exp Result: CLIENT_ERROR_START_RESOLVE
+// ====================================================================================================================
+TEST_F(General_TcpClient_Test_Start, NegTest_Unresolvable)
+{
+    EXPECT_EQ(tcpClient.start("nonexistent.invalid", port), CLIENT_ERROR_START_RESOLVE);
+    EXPECT_EQ(tcpServer.getClientIds().size(), 0);
+}
+
+// ====================================================================================================================
+// Desc:       Check if client start is aborted at the connect timeout
+// Steps:      Set connect timeout to 200 ms and try to start TCP client with a non-routable address
+// Exp Result: CLIENT_ERROR_START_CONNECT_TIMEOUT (CLIENT_ERROR_START_CONNECT if the network rejects the address immediately) within 2 seconds
+// ====================================================================================================================
+TEST_F(General_TcpClient_Test_Start, NegTest_ConnectTimeout)
+{
+    TcpClient tcpClientTimeout{'\x00'};
+    tcpClientTimeout.setConnectTimeout(chrono::milliseconds{200});
+
+    const auto startTime{chrono::steady_clock::now()};
+    const int code{tcpClientTimeout.start("10.255.255.1", port)};
+    const auto duration{chrono::steady_clock::now() - startTime};
+
+    EXPECT_TRUE(CLIENT_ERROR_START_CONNECT_TIMEOUT == code || CLIENT_ERROR_START_CONNECT == code) << "Return code: " << code;
+    EXPECT_LT(duration, chrono::seconds{2});
+}
+
+// ====================================================================================================================
+// Desc:       Check if many clients can be started in parallel with a shared resolver cache
+// Steps:      Start 10 TCP clients with startAsync, all using the same resolver cache
+// Exp Result: All futures return CLIENT_START_OK and the server knows 10 clients
+// ====================================================================================================================
+TEST_F(General_TcpClient_Test_Start, PosTest_StartAsync)
+{
+    auto resolverCache{make_shared<ResolverCache>()};
+    vector<unique_ptr<TcpClient>> clients;
+    vector<future<int>> starts;
+    for (int i{0}; i < 10; i += 1)
+    {
+        clients.push_back(make_unique<TcpClient>('\x00'));
+        clients.back()->setResolverCache(resolverCache);
+        clients.back()->setConnectTimeout(chrono::seconds{5});
+        starts.push_back(clients.back()->startAsync("localhost", port));
+    }
+
+    for (auto &start : starts)
+        EXPECT_EQ(start.get(), CLIENT_START_OK);
+    for (int i{0}; i < 100 && tcpServer.getClientIds().size() < 10; i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+    EXPECT_EQ(tcpServer.getClientIds().size(), 10);
+}
+
+// ====================================================================================================================
+// Desc:       Check if the resolver cache keeps resolved addresses and doesn't cache failures
+// Steps:      Resolve localhost and an unresolvable host twice
+// Exp Result: Same addresses for localhost, failure for the unresolvable host
+// ====================================================================================================================
+TEST_F(General_TcpClient_Test_Start, PosTest_ResolverCache)
+{
+    ResolverCache resolverCache{};
+    vector<ResolvedAddress> first, second;
+    ASSERT_TRUE(resolverCache.resolve("localhost", port, first));
+    ASSERT_TRUE(resolverCache.resolve("localhost", port, second));
+    ASSERT_EQ(first.size(), second.size());
+    for (size_t i{0}; i < first.size(); i += 1)
+    {
+        EXPECT_EQ(first[i].family, second[i].family);
+        EXPECT_EQ(first[i].length, second[i].length);
+        EXPECT_EQ(memcmp(&first[i].address, &second[i].address, first[i].length), 0);
+    }
+
+    EXPECT_FALSE(resolverCache.resolve("nonexistent.invalid", port, first));
+    EXPECT_FALSE(resolverCache.resolve("nonexistent.invalid", port, first));
+}
@@ -0,0 +1,150 @@
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+#include "general/TcpConnection_Test_SocketOptions.h"
+#include "HelperFunctions.h"
+
+using namespace std;
+using namespace Test;
+using namespace tcp;
+
+General_TcpConnection_Test_SocketOptions::General_TcpConnection_Test_SocketOptions() {}
+General_TcpConnection_Test_SocketOptions::~General_TcpConnection_Test_SocketOptions() {}
+
+void General_TcpConnection_Test_SocketOptions::SetUp()
+{
+    // Get free TCP port
+    port = HelperFunctions::getFreePort();
+    ASSERT_NE(port, -1) << "No free port found";
+
+    // Collect messages received by the server
+    tcpServer.setWorkOnMessage([this](const int, const string msg)
+                               {
+                                   lock_guard<mutex> lck{messages_m};
+                                   serverMessages.push_back(msg); });
+    return;
+}
+
+void General_TcpConnection_Test_SocketOptions::TearDown()
+{
+    // Stop TCP client and server
+    tcpClient.stop();
+    tcpServer.stop();
+
+    // Check if no pipe error occurred
+    EXPECT_FALSE(HelperFunctions::getAndResetPipeError()) << "Pipe error occurred!";
+
+    return;
+}
+
+void General_TcpConnection_Test_SocketOptions::connect()
+{
+    ASSERT_EQ(tcpServer.start(port), SERVER_START_OK) << "Unable to start TCP server on port " << port;
+    ASSERT_EQ(tcpClient.start("localhost", port), CLIENT_START_OK);
+    for (int i{0}; i < 100 && tcpServer.getAllClientIds().empty(); i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+    ASSERT_EQ(tcpServer.getAllClientIds().size(), 1);
+    return;
+}
+
+int General_TcpConnection_Test_SocketOptions::getOption(const int fd, const int level, const int name)
+{
+    int value{-1};
+    socklen_t value_len{sizeof(value)};
+    if (getsockopt(fd, level, name, &value, &value_len))
+        return -1;
+    return value;
+}
+
+// ====================================================================================================================
+// Desc:       Check if the server can be restarted on its port while closed connections are in TIME_WAIT
+// Steps:      Connect a client, stop the server (It closes the connection first) and start it again on the same port
+// Exp Result: SERVER_START_OK
+// ====================================================================================================================
+TEST_F(General_TcpConnection_Test_SocketOptions, PosTest_RestartWithTimeWait)
+{
+    connect();
+    tcpServer.stop();
+    this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+    EXPECT_EQ(tcpServer.start(port), SERVER_START_OK);
+}
+
+// ====================================================================================================================
+// Desc:       Check if all options are set on accepted connections
+// Steps:      Set no delay, quick ack, receive buffer size, keepalive and user timeout and connect a client
+// Exp Result: The accepted socket has all options set and messages are received
+// ====================================================================================================================
+TEST_F(General_TcpConnection_Test_SocketOptions, PosTest_AcceptedOptions)
+{
+    SocketOptions options;
+    options.noDelay = true;
+    options.quickAck = true;
+    options.receiveBufferSize = 1 << 17;
+    options.keepAlive = true;
+    options.keepAliveIdle = chrono::seconds{10};
+    options.keepAliveInterval = chrono::seconds{2};
+    options.keepAliveCount = 3;
+    options.userTimeout = chrono::milliseconds{5000};
+    options.backlog = 16;
+    tcpServer.setSocketOptions(options);
+    tcpClient.setSocketOptions(options);
+    connect();
+
+    const int clientId{tcpServer.getAllClientIds()[0]};
+    EXPECT_EQ(getOption(clientId, IPPROTO_TCP, TCP_NODELAY), 1);
+    EXPECT_EQ(getOption(clientId, SOL_SOCKET, SO_KEEPALIVE), 1);
+    EXPECT_EQ(getOption(clientId, IPPROTO_TCP, TCP_KEEPIDLE), 10);
+    EXPECT_EQ(getOption(clientId, IPPROTO_TCP, TCP_KEEPINTVL), 2);
+    EXPECT_EQ(getOption(clientId, IPPROTO_TCP, TCP_KEEPCNT), 3);
+    EXPECT_EQ(getOption(clientId, IPPROTO_TCP, TCP_USER_TIMEOUT), 5000);
+    EXPECT_LE(1 << 17, getOption(clientId, SOL_SOCKET, SO_RCVBUF));
+
+    // Messages are still transferred
+    for (int i{0}; i < 10; i += 1)
+        ASSERT_TRUE(tcpClient.sendMsg("Message " + to_string(i)));
+    for (int i{0}; i < 100; i += 1)
+    {
+        {
+            lock_guard<mutex> lck{messages_m};
+            if (10 <= serverMessages.size())
+                break;
+        }
+        this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+    }
+    lock_guard<mutex> lck{messages_m};
+    EXPECT_EQ(serverMessages.size(), 10);
+}
+
+// ====================================================================================================================
+// Desc:       Check if the client doesn't start with an option the kernel rejects
+// Steps:      Set a keepalive probe count above the kernel maximum (127) and start the client
+// Exp Result: CLIENT_ERROR_START_SET_SOCKET_OPT
+// ====================================================================================================================
+TEST_F(General_TcpConnection_Test_SocketOptions, NegTest_ClientInvalidOption)
+{
+    SocketOptions options;
+    options.keepAlive = true;
+    options.keepAliveCount = 1000;
+    tcpClient.setSocketOptions(options);
+    ASSERT_EQ(tcpServer.start(port), SERVER_START_OK) << "Unable to start TCP server on port " << port;
+    EXPECT_EQ(tcpClient.start("localhost", port), CLIENT_ERROR_START_SET_SOCKET_OPT);
+}
+
+// ====================================================================================================================
+// Desc:       Check if the server keeps a connection it can't tune
+// Steps:      Set a keepalive probe count above the kernel maximum (127) on the server and connect a client
+// Exp Result: The connection is accepted with default options
+// ====================================================================================================================
+TEST_F(General_TcpConnection_Test_SocketOptions, PosTest_ServerInvalidOption)
+{
+    SocketOptions options;
+    options.keepAlive = true;
+    options.keepAliveCount = 1000;
+    tcpServer.setSocketOptions(options);
+    connect();
+}
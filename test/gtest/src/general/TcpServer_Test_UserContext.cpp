@@ -0,0 +1,114 @@
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string>
+
+#include "general/TcpServer_Test_UserContext.h"
+#include "HelperFunctions.h"
+
+using namespace std;
+using namespace Test;
+using namespace tcp;
+
+General_TcpServer_Test_UserContext::General_TcpServer_Test_UserContext() {}
+General_TcpServer_Test_UserContext::~General_TcpServer_Test_UserContext() {}
+
+void General_TcpServer_Test_UserContext::SetUp()
+{
+    // Create a session for each established connection and use it as user context
+    tcpServer.setWorkOnEstablishedWithContext([this](const int tcpClientId) -> void *
+                                              {
+                                                  lock_guard<mutex> lck{sessions_m};
+                                                  sessions.emplace_back(new Session{});
+                                                  sessions.back()->clientId = tcpClientId;
+                                                  return sessions.back().get(); });
+
+    // Buffer incoming messages in the session passed as user context
+    tcpServer.setWorkOnMessageWithContext([](const int, void *context, const string msg)
+                                          {
+                                              Session *session{static_cast<Session *>(context)};
+                                              lock_guard<mutex> lck{session->messages_m};
+                                              session->messages.push_back(msg); });
+
+    // Remember all sessions passed on closed connections
+    tcpServer.setWorkOnClosedWithContext([this](const int, void *context)
+                                         {
+                                             lock_guard<mutex> lck{sessions_m};
+                                             closedSessions.push_back(static_cast<Session *>(context)); });
+
+    // Get free TCP port
+    port = HelperFunctions::getFreePort();
+    ASSERT_NE(port, -1) << "No free port found";
+
+    // Start TCP server and connect client
+    ASSERT_EQ(tcpServer.start(port), SERVER_START_OK) << "Unable to start TCP server on port " << port;
+    ASSERT_EQ(tcpClient.start("localhost", port), CLIENT_START_OK) << "Unable to connect TCP client to localhost on port " << port;
+
+    // Wait for session to be created
+    this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TCP);
+
+    // Get client ID
+    vector<int> clientIds{tcpServer.getAllClientIds()};
+    ASSERT_EQ(clientIds.size(), 1);
+    clientId = clientIds[0];
+
+    return;
+}
+
+void General_TcpServer_Test_UserContext::TearDown()
+{
+    // Stop TCP server and client
+    tcpClient.stop();
+    tcpServer.stop();
+
+    // Check if no pipe error occurred
+    EXPECT_FALSE(HelperFunctions::getAndResetPipeError()) << "Pipe error occurred!";
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Pass user context to message worker (positive)
+// Steps:      Send messages from client to server
+// Exp Result: Messages are stored in the session created on connection establishment
+// ====================================================================================================================
+TEST_F(General_TcpServer_Test_UserContext, PosTest_ContextOnMessage)
+{
+    // Send messages to server
+    ASSERT_TRUE(tcpClient.sendMsg("Hello"));
+    ASSERT_TRUE(tcpClient.sendMsg("World"));
+
+    // Wait for messages to be received
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TCP);
+
+    // Check session of the client
+    lock_guard<mutex> lck{sessions_m};
+    ASSERT_EQ(sessions.size(), 1);
+    EXPECT_EQ(sessions[0]->clientId, clientId);
+    lock_guard<mutex> lck_messages{sessions[0]->messages_m};
+    EXPECT_EQ(sessions[0]->messages.size(), 2);
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Pass user context to closed worker (positive)
+// Steps:      Disconnect client from server
+// Exp Result: Session created on connection establishment is passed to closed worker
+// ====================================================================================================================
+TEST_F(General_TcpServer_Test_UserContext, PosTest_ContextOnClosed)
+{
+    // Disconnect client
+    tcpClient.stop();
+
+    // Wait for connection to be closed
+    this_thread::sleep_for(TestConstants::WAITFOR_DISCONNECT_TCP);
+
+    // Check that the created session is passed
+    lock_guard<mutex> lck{sessions_m};
+    ASSERT_EQ(sessions.size(), 1);
+    ASSERT_EQ(closedSessions.size(), 1);
+    EXPECT_EQ(closedSessions[0], sessions[0].get());
+
+    return;
+}
@@ -0,0 +1,97 @@
+#include <chrono>
+#include <thread>
+
+#include "general/TlsClient_Test_Reconnect.h"
+#include "HelperFunctions.h"
+#include "TestDefines.h"
+
+using namespace std;
+using namespace Test;
+using namespace tcp;
+
+General_TlsClient_Test_Reconnect::General_TlsClient_Test_Reconnect() {}
+General_TlsClient_Test_Reconnect::~General_TlsClient_Test_Reconnect() {}
+
+void General_TlsClient_Test_Reconnect::SetUp()
+{
+    // Get free TLS port
+    port = HelperFunctions::getFreePort();
+    ASSERT_NE(port, -1) << "No free port found";
+    ASSERT_EQ(tlsServer.start(port), SERVER_START_OK) << "Unable to start TLS server on port " << port;
+
+    // Reconnect quickly and count successful reconnects
+    ReconnectPolicy policy;
+    policy.initialDelay = chrono::milliseconds{10};
+    policy.maxDelay = chrono::milliseconds{50};
+    tlsClient.setReconnectPolicy(policy);
+    tlsClient.setWorkOnReconnect([this](const bool success, const unsigned int)
+                                 {
+                                     if (success)
+                                         reconnects += 1; });
+
+    // Start TLS client with client and server authentication
+    tlsClient.setCertificates(KeyPaths::CaCert, KeyPaths::ClientCert, KeyPaths::ClientKey);
+    ASSERT_EQ(tlsClient.start("localhost", port), CLIENT_START_OK);
+    for (int i{0}; i < 100 && tlsServer.getClientIds().empty(); i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TLS);
+    ASSERT_EQ(tlsServer.getClientIds().size(), 1);
+    return;
+}
+
+void General_TlsClient_Test_Reconnect::TearDown()
+{
+    // Stop TLS server and client
+    tlsClient.stop();
+    tlsServer.stop();
+
+    // Check if no pipe error occurred
+    EXPECT_FALSE(HelperFunctions::getAndResetPipeError()) << "Pipe error occurred!";
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Check if the TLS client resumes its session when reconnecting
+// Steps:      Drop the connection of the client after the session is received and send a message after reconnecting
+// Exp Result: First connection uses a full handshake, the reconnected one resumes the session, the server receives the message
+// ====================================================================================================================
+TEST_F(General_TlsClient_Test_Reconnect, PosTest_SessionResumed)
+{
+    // Give the client time to receive the session ticket sent after the handshake
+    this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TLS);
+    EXPECT_FALSE(tlsClient.isSessionReused());
+
+    tlsClient.dropConnection();
+    for (int i{0}; i < 100 && 0 == reconnects; i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TLS);
+    ASSERT_EQ(reconnects, 1) << "Client didn't reconnect";
+    EXPECT_TRUE(tlsClient.isRunning());
+    EXPECT_TRUE(tlsClient.isSessionReused());
+
+    for (int i{0}; i < 100 && tlsServer.getClientIds().size() != 1; i += 1)
+        this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TLS);
+    ASSERT_EQ(tlsServer.getClientIds().size(), 1);
+
+    EXPECT_TRUE(tlsClient.sendMsg("Hello after reconnect"));
+    this_thread::sleep_for(TestConstants::WAITFOR_MSG_TLS);
+    vector<TestApi::MessageFromClient> messages{tlsServer.getBufferedMsg()};
+    ASSERT_EQ(messages.size(), 1);
+    EXPECT_EQ(messages[0].msg, "Hello after reconnect");
+}
+
+// ====================================================================================================================
+// Desc:       Check if a new start of the TLS client doesn't resume the session of the last start
+// Steps:      Stop and start the TLS client again
+// Exp Result: Full handshake
+// ====================================================================================================================
+TEST_F(General_TlsClient_Test_Reconnect, PosTest_NewStartFullHandshake)
+{
+    this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TLS);
+    tlsClient.stop();
+    ASSERT_EQ(tlsClient.start("localhost", port), CLIENT_START_OK);
+    EXPECT_FALSE(tlsClient.isSessionReused());
+    EXPECT_EQ(reconnects, 0);
+
+    // Give the client time to receive the session ticket before stopping (Unread data would reset the connection)
+    this_thread::sleep_for(TestConstants::WAITFOR_CONNECT_TLS);
+}
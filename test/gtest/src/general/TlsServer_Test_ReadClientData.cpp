@@ -111,3 +111,55 @@ TEST_F(General_TlsServer_Test_ReadClientData, NegTest_ReadClientSubjectPart_Inva
 
     return;
 }
+
+// ====================================================================================================================
+// Desc:       Visit connected clients (positive)
+// Steps:      Visit all connected clients and compare with list of client IDs
+// Exp Result: Exactly the connected client is visited
+// ====================================================================================================================
+TEST_F(General_TlsServer_Test_ReadClientData, PosTest_VisitClients)
+{
+    // Visit all connected clients
+    vector<int> visitedIds{tlsServer.getClientIdsVisited()};
+
+    // Check the visited clients
+    EXPECT_EQ(visitedIds, vector<int>{clientId});
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Read Client connection info (positive)
+// Steps:      Read the connection metadata of the connected client
+// Exp Result: Metadata is captured on connection establishment
+// ====================================================================================================================
+TEST_F(General_TlsServer_Test_ReadClientData, PosTest_ReadClientInfo)
+{
+    // Read client connection info
+    ConnectionInfo clientInfo{tlsServer.getClientInfo(clientId)};
+
+    // Check the client address
+    EXPECT_EQ(clientInfo.ip, "127.0.0.1");
+    EXPECT_NE(clientInfo.port, 0);
+
+    // Check the connection timestamps
+    EXPECT_LE(clientInfo.acceptedAt, clientInfo.establishedAt);
+
+    // Check the client certificate subject
+    EXPECT_EQ(clientInfo.certSubject[NID_localityName], "<my city>");
+
+    return;
+}
+
+// ====================================================================================================================
+// Desc:       Read Client connection info (negative)
+// Steps:      Read the connection metadata of a not connected client
+// Exp Result: Exception is thrown
+// ====================================================================================================================
+TEST_F(General_TlsServer_Test_ReadClientData, NegTest_ReadClientInfo_NotConnected)
+{
+    // Read client connection info
+    EXPECT_THROW(tlsServer.getClientInfo(0), Server_error); // 0 never exists as a client ID
+
+    return;
+}